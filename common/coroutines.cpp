@@ -91,6 +91,101 @@ CoroBaseContext::~CoroBaseContext() {
 	delete _subctx;
 }
 
+//--------------------- Context Pool ------------------------
+
+namespace {
+
+enum {
+	/** Contexts are pooled in size classes of this many bytes... */
+	kCoroPoolGranularity = 16,
+	/** ...up to this many classes; bigger contexts come from the heap */
+	kCoroPoolClasses = 16,
+	/** Number of contexts carved out of each slab */
+	kCoroPoolBlocksPerSlab = 32
+};
+
+struct CoroPoolBlock {
+	CoroPoolBlock *next;
+};
+
+/** Free contexts, per size class */
+static CoroPoolBlock *s_coroFreeBlocks[kCoroPoolClasses];
+
+/** All slabs allocated so far; the first block of each slab links them */
+static CoroPoolBlock *s_coroSlabs = 0;
+
+/** Number of pooled contexts currently in use */
+static int s_coroLiveBlocks = 0;
+
+} // End of anonymous namespace
+
+#ifdef DEBUG
+uint32 CoroBaseContext::_numAllocs = 0;
+#endif
+
+void *CoroBaseContext::operator new(size_t size) {
+#ifdef DEBUG
+	++_numAllocs;
+#endif
+	const uint sizeClass = (size + kCoroPoolGranularity - 1) / kCoroPoolGranularity - 1;
+	if (sizeClass >= kCoroPoolClasses) {
+		void *ptr = malloc(size);
+		if (!ptr)
+			error("Cannot allocate memory for coroutine context");
+		return ptr;
+	}
+
+	if (!s_coroFreeBlocks[sizeClass]) {
+		// Carve a new slab into blocks, keeping the first one as slab link
+		const uint blockSize = (sizeClass + 1) * kCoroPoolGranularity;
+		byte *slab = (byte *)malloc((kCoroPoolBlocksPerSlab + 1) * blockSize);
+		if (!slab)
+			error("Cannot allocate memory for coroutine context");
+
+		((CoroPoolBlock *)slab)->next = s_coroSlabs;
+		s_coroSlabs = (CoroPoolBlock *)slab;
+
+		for (int i = kCoroPoolBlocksPerSlab; i > 0; --i) {
+			CoroPoolBlock *block = (CoroPoolBlock *)(slab + i * blockSize);
+			block->next = s_coroFreeBlocks[sizeClass];
+			s_coroFreeBlocks[sizeClass] = block;
+		}
+	}
+
+	CoroPoolBlock *block = s_coroFreeBlocks[sizeClass];
+	s_coroFreeBlocks[sizeClass] = block->next;
+	++s_coroLiveBlocks;
+	return block;
+}
+
+void CoroBaseContext::operator delete(void *ptr, size_t size) {
+	if (!ptr)
+		return;
+
+	const uint sizeClass = (size + kCoroPoolGranularity - 1) / kCoroPoolGranularity - 1;
+	if (sizeClass >= kCoroPoolClasses) {
+		free(ptr);
+		return;
+	}
+
+	CoroPoolBlock *block = (CoroPoolBlock *)ptr;
+	block->next = s_coroFreeBlocks[sizeClass];
+	s_coroFreeBlocks[sizeClass] = block;
+	--s_coroLiveBlocks;
+}
+
+void CoroBaseContext::purgePool() {
+	if (s_coroLiveBlocks)
+		return;
+
+	while (s_coroSlabs) {
+		CoroPoolBlock *next = s_coroSlabs->next;
+		free(s_coroSlabs);
+		s_coroSlabs = next;
+	}
+	Common::fill(&s_coroFreeBlocks[0], &s_coroFreeBlocks[kCoroPoolClasses], (CoroPoolBlock *)0);
+}
+
 //--------------------- Scheduler Class ------------------------
 
 CoroutineScheduler::CoroutineScheduler() {
@@ -102,6 +197,12 @@ CoroutineScheduler::CoroutineScheduler() {
 	// diagnostic process counters
 	numProcs = 0;
 	maxProcs = 0;
+
+	_numFrames = 0;
+	_numWakeups = 0;
+	_numContextAllocs = 0;
+	_numWaiting = 0;
+	_maxWaiting = 0;
 #endif
 
 	pRCfunction = NULL;
@@ -133,6 +234,8 @@ CoroutineScheduler::~CoroutineScheduler() {
 	Common::List<EVENT *>::iterator i;
 	for (i = _events.begin(); i != _events.end(); ++i)
 		delete *i;
+
+	CoroBaseContext::purgePool();
 }
 
 void CoroutineScheduler::reset() {
@@ -160,11 +263,14 @@ void CoroutineScheduler::reset() {
 		delete pProc->state;
 		pProc->state = 0;
 		Common::fill(&pProc->pidWaiting[0], &pProc->pidWaiting[CORO_MAX_PID_WAITING], 0);
+		pProc->parked = false;
 		pProc = pProc->pNext;
 	}
 
 	// no active processes
 	pCurrent = active->pNext = NULL;
+	_processIndex.clear();
+	_waitLists.clear();
 
 	// place first process on free list
 	pFreeProcesses = processList;
@@ -180,6 +286,12 @@ void CoroutineScheduler::reset() {
 #ifdef DEBUG
 void CoroutineScheduler::printStats() {
 	debug("%i process of %i used", maxProcs, CORO_NUM_PROCESS);
+
+	if (_numFrames) {
+		debug("%.1f context allocations, %.1f wakeups per frame",
+		      (double)_numContextAllocs / _numFrames, (double)_numWakeups / _numFrames);
+		debug("%i processes waiting (max %i)", _numWaiting, _maxWaiting);
+	}
 }
 #endif
 
@@ -220,12 +332,34 @@ void CoroutineScheduler::checkStack() {
 
 void CoroutineScheduler::schedule() {
 	// start dispatching active process list
+	const uint32 time = g_system->getMillis();
 	PROCESS *pNext;
 	PROCESS *pProc = active->pNext;
+#ifdef DEBUG
+	_numWaiting = 0;
+#endif
 	while (pProc != NULL) {
 		pNext = pProc->pNext;
 
+#ifdef DEBUG
+		if (pProc->pidWaiting[0])
+			++_numWaiting;
+#endif
+
+		if (pProc->parked) {
+			// Leave waiting processes alone until they are woken or time out
+			if (pProc->wakeTime == CORO_INFINITE || time < pProc->wakeTime) {
+				pProc = pNext;
+				continue;
+			}
+
+			unparkProcess(pProc);
+		}
+
 		if (--pProc->sleepTime <= 0) {
+#ifdef DEBUG
+			++_numWakeups;
+#endif
 			// process is ready for dispatch, activate it
 			pCurrent = pProc;
 			pProc->coroAddr(pProc->state, pProc->param);
@@ -254,6 +388,14 @@ void CoroutineScheduler::schedule() {
 			evt->pulsing = evt->signalled = false;
 		}
 	}
+
+#ifdef DEBUG
+	if (_numWaiting > _maxWaiting)
+		_maxWaiting = _numWaiting;
+	_numContextAllocs += CoroBaseContext::_numAllocs;
+	CoroBaseContext::_numAllocs = 0;
+	++_numFrames;
+#endif
 }
 
 void CoroutineScheduler::rescheduleAll() {
@@ -387,7 +529,8 @@ void CoroutineScheduler::waitForSingleObject(CORO_PARAM, int pid, uint32 duratio
 			break;
 		}
 
-		// Sleep until the next cycle
+		// Sleep until the process or event changes state, or the wait expires
+		parkProcess(pCurrent, 1, (_ctx->endTime == CORO_INFINITE) ? CORO_INFINITE : _ctx->endTime + 1);
 		CORO_SLEEP(1);
 	}
 
@@ -454,7 +597,8 @@ void CoroutineScheduler::waitForMultipleObjects(CORO_PARAM, int nCount, uint32 *
 			break;
 		}
 
-		// Sleep until the next cycle
+		// Sleep until one of the processes or events changes state, or the wait expires
+		parkProcess(pCurrent, nCount, (_ctx->endTime == CORO_INFINITE) ? CORO_INFINITE : _ctx->endTime + 1);
 		CORO_SLEEP(1);
 	}
 
@@ -480,7 +624,8 @@ void CoroutineScheduler::sleep(CORO_PARAM, uint32 duration) {
 
 	// Outer loop for doing checks until expiry
 	while (g_system->getMillis() < _ctx->endTime) {
-		// Sleep until the next cycle
+		// Sleep until the time is up
+		parkProcess(pCurrent, 0, _ctx->endTime);
 		CORO_SLEEP(1);
 	}
 
@@ -538,6 +683,10 @@ PROCESS *CoroutineScheduler::createProcess(uint32 pid, CORO_ADDR coroAddr, const
 
 	// set new process id
 	pProc->pid = pid;
+	indexProcess(pProc);
+
+	// not waiting on anything yet
+	pProc->parked = false;
 
 	// set new process specific info
 	if (sizeParam) {
@@ -577,6 +726,10 @@ void CoroutineScheduler::killProcess(PROCESS *pKillProc) {
 	if (pRCfunction != NULL)
 		(pRCfunction)(pKillProc);
 
+	unindexProcess(pKillProc);
+	unparkProcess(pKillProc);
+	wakeWaiters(pKillProc->pid);
+
 	delete pKillProc->state;
 	pKillProc->state = 0;
 
@@ -626,6 +779,10 @@ int CoroutineScheduler::killMatchingProcess(uint32 pidKill, int pidMask) {
 				if (pRCfunction != NULL)
 					(pRCfunction)(pProc);
 
+				unindexProcess(pProc);
+				unparkProcess(pProc);
+				wakeWaiters(pProc->pid);
+
 				delete pProc->state;
 				pProc->state = 0;
 
@@ -662,23 +819,87 @@ void CoroutineScheduler::setResourceCallback(VFPTRPP pFunc) {
 	pRCfunction = pFunc;
 }
 
+void CoroutineScheduler::indexProcess(PROCESS *pProc) {
+	ProcessIndex::iterator i = _processIndex.find(pProc->pid);
+	pProc->pNextSamePid = (i != _processIndex.end()) ? i->_value : NULL;
+	_processIndex[pProc->pid] = pProc;
+}
+
+void CoroutineScheduler::unindexProcess(PROCESS *pProc) {
+	ProcessIndex::iterator i = _processIndex.find(pProc->pid);
+	assert(i != _processIndex.end());
+
+	if (i->_value == pProc) {
+		if (pProc->pNextSamePid)
+			i->_value = pProc->pNextSamePid;
+		else
+			_processIndex.erase(i);
+	} else {
+		// Several processes can share an Id; unlink it from the chain
+		PROCESS *pPrev = i->_value;
+		while (pPrev->pNextSamePid != pProc)
+			pPrev = pPrev->pNextSamePid;
+		pPrev->pNextSamePid = pProc->pNextSamePid;
+	}
+
+	pProc->pNextSamePid = NULL;
+}
+
 PROCESS *CoroutineScheduler::getProcess(uint32 pid) {
-	PROCESS *pProc = active->pNext;
-	while ((pProc != NULL) && (pProc->pid != pid))
-		pProc = pProc->pNext;
+	ProcessIndex::iterator i = _processIndex.find(pid);
+	return (i != _processIndex.end()) ? i->_value : NULL;
+}
 
-	return pProc;
+void CoroutineScheduler::parkProcess(PROCESS *pProc, int nCount, uint32 wakeTime) {
+	assert(!pProc->parked);
+	assert(nCount < CORO_MAX_PID_WAITING);
+
+	pProc->parked = true;
+	pProc->numParkedPids = nCount;
+	pProc->wakeTime = wakeTime;
+
+	for (int i = 0; i < nCount; ++i)
+		_waitLists[pProc->pidWaiting[i]].push_back(pProc);
 }
 
-EVENT *CoroutineScheduler::getEvent(uint32 pid) {
-	Common::List<EVENT *>::iterator i;
-	for (i = _events.begin(); i != _events.end(); ++i) {
-		EVENT *evt = *i;
-		if (evt->pid == pid)
-			return evt;
+void CoroutineScheduler::unparkProcess(PROCESS *pProc) {
+	if (!pProc->parked)
+		return;
+
+	pProc->parked = false;
+
+	for (int i = 0; i < pProc->numParkedPids; ++i) {
+		WaitListMap::iterator wl = _waitLists.find(pProc->pidWaiting[i]);
+		if (wl == _waitLists.end())
+			continue;
+
+		Common::Array<PROCESS *> &waiters = wl->_value;
+		for (uint j = 0; j < waiters.size(); ++j) {
+			if (waiters[j] == pProc) {
+				waiters.remove_at(j);
+				break;
+			}
+		}
+
+		if (waiters.empty())
+			_waitLists.erase(wl);
 	}
+}
+
+void CoroutineScheduler::wakeWaiters(uint32 pid) {
+	WaitListMap::iterator wl = _waitLists.find(pid);
+	if (wl == _waitLists.end())
+		return;
 
-	return NULL;
+	// Unparking edits the wait lists, so work on a copy
+	Common::Array<PROCESS *> waiters = wl->_value;
+	for (uint i = 0; i < waiters.size(); ++i)
+		unparkProcess(waiters[i]);
+}
+
+EVENT *CoroutineScheduler::getEvent(uint32 pid) {
+	EventIndex::iterator i = _eventIndex.find(pid);
+	return (i != _eventIndex.end()) ? i->_value : NULL;
 }
 
 
@@ -690,6 +911,7 @@ uint32 CoroutineScheduler::createEvent(bool bManualReset, bool bInitialState) {
 	evt->pulsing = false;
 
 	_events.push_back(evt);
+	_eventIndex[evt->pid] = evt;
 	return evt->pid;
 }
 
@@ -697,14 +919,19 @@ void CoroutineScheduler::closeEvent(uint32 pidEvent) {
 	EVENT *evt = getEvent(pidEvent);
 	if (evt) {
 		_events.remove(evt);
+		_eventIndex.erase(pidEvent);
 		delete evt;
+
+		wakeWaiters(pidEvent);
 	}
 }
 
 void CoroutineScheduler::setEvent(uint32 pidEvent) {
 	EVENT *evt = getEvent(pidEvent);
-	if (evt)
+	if (evt) {
 		evt->signalled = true;
+		wakeWaiters(pidEvent);
+	}
 }
 
 void CoroutineScheduler::resetEvent(uint32 pidEvent) {
@@ -721,6 +948,7 @@ void CoroutineScheduler::pulseEvent(uint32 pidEvent) {
 	// Set the event as signalled and pulsing
 	evt->signalled = true;
 	evt->pulsing = true;
+	wakeWaiters(pidEvent);
 
 	// If there's an active process, and it's not the first in the queue, then reschedule all
 	// the other prcoesses in the queue to run again this frame
@@ -25,6 +25,8 @@
 #include "common/scummsys.h"
 #include "common/util.h"    // for SCUMMVM_CURRENT_FUNCTION
 #include "common/list.h"
+#include "common/hashmap.h"
+#include "common/array.h"
 #include "common/singleton.h"
 
 namespace Common {
@@ -65,6 +67,25 @@ struct CoroBaseContext {
 	 * Destructor for coroutine context
 	 */
 	virtual ~CoroBaseContext();
+
+	/**
+	 * Contexts are created and destroyed on nearly every coroutine call,
+	 * so they are carved out of per size class slabs and recycled on
+	 * CORO_END_CODE instead of going through the heap each time.
+	 */
+	static void *operator new(size_t size);
+	static void operator delete(void *ptr, size_t size);
+
+	/**
+	 * Releases the memory held by the context pool. Does nothing while
+	 * any context is still alive.
+	 */
+	static void purgePool();
+
+#ifdef DEBUG
+	/** Number of contexts allocated since the counter was last reset */
+	static uint32 _numAllocs;
+#endif
 };
 
 typedef CoroBaseContext *CoroContext;
@@ -307,6 +328,12 @@ struct PROCESS {
 	uint32 pid;         ///< process ID
 	uint32 pidWaiting[CORO_MAX_PID_WAITING];    ///< Process ID(s) process is currently waiting on
 	char param[CORO_PARAM_SIZE];    ///< process specific info
+
+	PROCESS *pNextSamePid;  ///< next active process with the same process ID
+
+	bool parked;        ///< process is waiting, and is not resumed until woken or timed out
+	int numParkedPids;  ///< number of entries in pidWaiting the parked process is listed under
+	uint32 wakeTime;    ///< time at which a parked process times out, or CORO_INFINITE
 };
 typedef PROCESS *PPROCESS;
 
@@ -360,11 +387,49 @@ private:
 	/** Event list */
 	Common::List<EVENT *> _events;
 
+	typedef Common::HashMap<uint32, PROCESS *> ProcessIndex;
+	typedef Common::HashMap<uint32, EVENT *> EventIndex;
+
+	/** Active processes by process Id, chained through pNextSamePid */
+	ProcessIndex _processIndex;
+
+	/** Events by process Id */
+	EventIndex _eventIndex;
+
+	void indexProcess(PROCESS *pProc);
+	void unindexProcess(PROCESS *pProc);
+
+	typedef Common::HashMap<uint32, Common::Array<PROCESS *> > WaitListMap;
+
+	/** Parked processes, by the process/event Id they are waiting on */
+	WaitListMap _waitLists;
+
+	/**
+	 * Parks the current process, so that schedule() skips it until one of
+	 * the first nCount Ids in its pidWaiting list changes state, or the
+	 * given time is reached. It stays in the active list, so the order in
+	 * which processes run is unaffected.
+	 */
+	void parkProcess(PROCESS *pProc, int nCount, uint32 wakeTime);
+	void unparkProcess(PROCESS *pProc);
+
+	/**
+	 * Wakes all processes parked on the given process/event Id.
+	 */
+	void wakeWaiters(uint32 pid);
+
 #ifdef DEBUG
 	// diagnostic process counters
 	int numProcs;
 	int maxProcs;
 
+	// diagnostic scheduler counters
+	uint32 _numFrames;
+	uint32 _numWakeups;
+	uint32 _numContextAllocs;
+	int _numWaiting;
+	int _maxWaiting;
+
 	/**
 	 * Checks both the active and free process list to insure all the links are valid,
 	 * and that no processes have been lost
@@ -388,7 +453,9 @@ public:
 
 #ifdef DEBUG
 	/**
-	 * Shows the maximum number of process used at once.
+	 * Shows the maximum number of process used at once, along with
+	 * averaged scheduler counters (context allocations and process
+	 * wakeups per frame, and the number of processes waiting on others).
 	 */
 	void printStats();
 #endif
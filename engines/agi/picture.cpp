@@ -27,6 +27,11 @@
 
 namespace Agi {
 
+enum {
+	/** Memory budget for fully drawn pictures kept by the picture cache */
+	kPictureCacheMaxSize = 1024 * 1024
+};
+
 PictureMgr::PictureMgr(AgiBase *agi, GfxMgr *gfx) {
 	_vm = agi;
 	_gfx = gfx;
@@ -41,6 +46,12 @@ PictureMgr::PictureMgr(AgiBase *agi, GfxMgr *gfx) {
 	_minCommand = 0xf0;
 	_flags = 0;
 	_currentStep = 0;
+
+	_pictureCacheSize = 0;
+}
+
+PictureMgr::~PictureMgr() {
+	clearPictureCache();
 }
 
 void PictureMgr::putVirtPixel(int x, int y) {
@@ -227,27 +238,24 @@ void PictureMgr::absoluteDrawLine() {
 /**************************************************************************
 ** okToFill
 **************************************************************************/
-int PictureMgr::isOkFillHere(int x, int y) {
-	uint8 p;
-
-	x += _xOffset;
-	y += _yOffset;
-
-	if (x < 0 || x >= _width || y < 0 || y >= _height)
-		return false;
-
-	p = _vm->_game.sbuf16c[y * _width + x];
-
-	if (_flags & kPicFTrollMode)
-		return ((p & 0x0f) != 11 && (p & 0x0f) != _scrColor);
-
-	if (!_priOn && _scrOn && _scrColor != 15)
+enum FillMode {
+	kFillNone,
+	kFillTroll,
+	kFillScreen,
+	kFillPriority
+};
+
+static inline bool isOkFillHere(uint8 p, FillMode mode, uint8 scrColor) {
+	switch (mode) {
+	case kFillTroll:
+		return ((p & 0x0f) != 11 && (p & 0x0f) != scrColor);
+	case kFillScreen:
 		return (p & 0x0f) == 15;
-
-	if (_priOn && !_scrOn && _priColor != 4)
+	case kFillPriority:
 		return (p >> 4) == 4;
-
-	return (_scrOn && (p & 0x0f) == 15 && _scrColor != 15);
+	default:
+		return false;
+	}
 }
 
 /**************************************************************************
@@ -257,42 +265,66 @@ void PictureMgr::agiFill(unsigned int x, unsigned int y) {
 	if (!_scrOn && !_priOn)
 		return;
 
+	// Which pixels may be filled only depends on the current drawing
+	// colors, so decide that once rather than for every pixel
+	FillMode mode;
+	if (_flags & kPicFTrollMode)
+		mode = kFillTroll;
+	else if (_scrOn && _scrColor != 15)
+		mode = kFillScreen;
+	else if (_priOn && !_scrOn && _priColor != 4)
+		mode = kFillPriority;
+	else
+		return;
+
+	const uint8 scrColor = _scrColor;
+	const uint8 priMask = _priOn ? 0x0f : 0xff;
+	const uint8 priBits = _priOn ? (_priColor << 4) : 0;
+	const uint8 scrMask = _scrOn ? 0xf0 : 0xff;
+	const uint8 scrBits = _scrOn ? _scrColor : 0;
+
 	// Push initial pixel on the stack
 	Common::Stack<Common::Point> stack;
-	stack.push(Common::Point(x,y));
+	stack.push(Common::Point(x + _xOffset, y + _yOffset));
 
 	// Exit if stack is empty
 	while (!stack.empty()) {
 		Common::Point p = stack.pop();
-		unsigned int c;
-		int newspanUp, newspanDown;
 
-		if (!isOkFillHere(p.x, p.y))
+		if (p.x < 0 || p.x >= _width || p.y < 0 || p.y >= _height)
 			continue;
 
-		// Scan for left border
-		for (c = p.x - 1; isOkFillHere(c, p.y); c--)
-			;
-
-		newspanUp = newspanDown = 1;
-		for (c++; isOkFillHere(c, p.y); c++) {
-			putVirtPixel(c, p.y);
-			if (isOkFillHere(c, p.y - 1)) {
-				if (newspanUp) {
-					stack.push(Common::Point(c,p.y-1));
-					newspanUp = 0;
-				}
-			} else {
-				newspanUp = 1;
-			}
+		uint8 *row = &_vm->_game.sbuf16c[p.y * _width];
+		if (!isOkFillHere(row[p.x], mode, scrColor))
+			continue;
 
-			if (isOkFillHere(c, p.y + 1)) {
-				if (newspanDown) {
-					stack.push(Common::Point(c,p.y+1));
-					newspanDown = 0;
+		// Find the span of fillable pixels around the seed
+		int left = p.x, right = p.x;
+		while (left > 0 && isOkFillHere(row[left - 1], mode, scrColor))
+			left--;
+		while (right < _width - 1 && isOkFillHere(row[right + 1], mode, scrColor))
+			right++;
+
+		for (int c = left; c <= right; c++)
+			row[c] = (((row[c] & priMask) | priBits) & scrMask) | scrBits;
+
+		// Seed each run of fillable pixels above and below the span
+		for (int dy = -1; dy <= 1; dy += 2) {
+			const int ny = p.y + dy;
+			if (ny < 0 || ny >= _height)
+				continue;
+
+			const uint8 *nrow = row + dy * _width;
+			bool newspan = true;
+			for (int c = left; c <= right; c++) {
+				if (isOkFillHere(nrow[c], mode, scrColor)) {
+					if (newspan) {
+						stack.push(Common::Point(c, ny));
+						newspan = false;
+					}
+				} else {
+					newspan = true;
 				}
-			} else {
-				newspanDown = 1;
 			}
 		}
 	}
@@ -820,10 +852,15 @@ int PictureMgr::decodePicture(int n, int clr, bool agi256, int pic_width, int pi
 	_width = pic_width;
 	_height = pic_height;
 
-	if (clr && !agi256) // 256 color pictures should always fill the whole screen, so no clearing for them.
-		memset(_vm->_game.sbuf16c, 0x4f, _width * _height); // Clear 16 color AGI screen (Priority 4, color white).
-
-	if (!agi256) {
+	if (clr && !agi256) {
+		// A picture drawn onto a cleared screen only depends on the picture
+		// itself, so revisiting a room can reuse what was drawn last time
+		if (!restoreCachedPicture(n)) {
+			memset(_vm->_game.sbuf16c, 0x4f, _width * _height); // Clear 16 color AGI screen (Priority 4, color white).
+			drawPicture();
+			cachePicture(n);
+		}
+	} else if (!agi256) {
 		drawPicture(); // Draw 16 color picture.
 	} else {
 		const uint32 maxFlen = _width * _height;
@@ -894,6 +931,64 @@ void PictureMgr::clear() {
 	memset(_vm->_game.sbuf16c, 0x4f, _width * _height);
 }
 
+bool PictureMgr::restoreCachedPicture(int n) {
+	for (Common::List<CachedPicture>::iterator i = _pictureCache.begin(); i != _pictureCache.end(); ++i) {
+		if (i->picNr == n && i->width == _width && i->height == _height && i->xOffset == _xOffset
+		        && i->yOffset == _yOffset && i->flags == _flags && i->version == _pictureVersion) {
+			memcpy(_vm->_game.sbuf16c, i->screen, _width * _height);
+
+			// Move the picture to the front of the cache
+			if (i != _pictureCache.begin()) {
+				CachedPicture pic = *i;
+				_pictureCache.erase(i);
+				_pictureCache.push_front(pic);
+			}
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void PictureMgr::cachePicture(int n) {
+	// Step mode shows the drawing as it progresses, so leave it alone
+	if (_flags & kPicFStep)
+		return;
+
+	const uint32 size = _width * _height;
+
+	// Make room by dropping the least recently used pictures
+	while (!_pictureCache.empty() && _pictureCacheSize + size > kPictureCacheMaxSize) {
+		_pictureCacheSize -= _pictureCache.back().width * _pictureCache.back().height;
+		free(_pictureCache.back().screen);
+		_pictureCache.pop_back();
+	}
+
+	CachedPicture pic;
+	pic.picNr = n;
+	pic.width = _width;
+	pic.height = _height;
+	pic.xOffset = _xOffset;
+	pic.yOffset = _yOffset;
+	pic.flags = _flags;
+	pic.version = _pictureVersion;
+	pic.screen = (uint8 *)malloc(size);
+	if (!pic.screen)
+		return;
+
+	memcpy(pic.screen, _vm->_game.sbuf16c, size);
+	_pictureCache.push_front(pic);
+	_pictureCacheSize += size;
+}
+
+void PictureMgr::clearPictureCache() {
+	for (Common::List<CachedPicture>::iterator i = _pictureCache.begin(); i != _pictureCache.end(); ++i)
+		free(i->screen);
+
+	_pictureCache.clear();
+	_pictureCacheSize = 0;
+}
+
 /**
  * Show AGI picture.
  * This function copies a ``hidden'' AGI picture to the output device.
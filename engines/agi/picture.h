@@ -23,6 +23,8 @@
 #ifndef AGI_PICTURE_H
 #define AGI_PICTURE_H
 
+#include "common/list.h"
+
 namespace Agi {
 
 #define _DEFAULT_WIDTH		160
@@ -65,7 +67,6 @@ private:
 	void drawLine(int x1, int y1, int x2, int y2);
 	void dynamicDrawLine();
 	void absoluteDrawLine();
-	int isOkFillHere(int x, int y);
 	void agiFill(unsigned int x, unsigned int y);
 	void xCorner(bool skipOtherCoords = false);
 	void yCorner(bool skipOtherCoords = false);
@@ -77,6 +78,7 @@ private:
 
 public:
 	PictureMgr(AgiBase *agi, GfxMgr *gfx);
+	~PictureMgr();
 
 	void putVirtPixel(int x, int y);
 
@@ -137,6 +139,27 @@ private:
 
 	int _flags;
 	int _currentStep;
+
+	/**
+	 * A fully drawn picture (visual and priority screen), as decodePicture()
+	 * leaves it when drawing onto a cleared screen.
+	 */
+	struct CachedPicture {
+		int picNr;
+		int width, height;
+		int xOffset, yOffset;
+		int flags;
+		AgiPictureVersion version;
+		uint8 *screen;
+	};
+
+	/** Cached pictures, most recently used first */
+	Common::List<CachedPicture> _pictureCache;
+	uint32 _pictureCacheSize;
+
+	bool restoreCachedPicture(int n);
+	void cachePicture(int n);
+	void clearPictureCache();
 };
 
 } // End of namespace Agi
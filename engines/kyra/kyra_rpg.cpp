@@ -49,7 +49,8 @@ KyraRpgEngine::KyraRpgEngine(OSystem *system, const GameFlags &flags) : KyraEngi
 	_vmpPtr = 0;
 	_blockBrightness = _wllVcnOffset = 0;
 	_blockDrawingBuffer = 0;
-	_sceneWindowBuffer = 0;
+	_vcnCache = 0;
+	_vcnCacheCounter = 0;
 	_monsterShapes = _monsterPalettes = 0;
 
 	_doorShapes = 0;
@@ -133,7 +134,7 @@ KyraRpgEngine::~KyraRpgEngine() {
 	delete[] _vcnTransitionMask;
 	delete[] _vcnShift;
 	delete[] _blockDrawingBuffer;
-	delete[] _sceneWindowBuffer;
+	delete[] _vcnCache;
 
 	delete[] _lvlShapeTop;
 	delete[] _lvlShapeBottom;
@@ -168,8 +169,8 @@ Common::Error KyraRpgEngine::init() {
 
 	_blockDrawingBuffer = new uint16[1320];
 	memset(_blockDrawingBuffer, 0, 1320 * sizeof(uint16));
-	_sceneWindowBuffer = new uint8[21120];
-	memset(_sceneWindowBuffer, 0, 21120);
+	_vcnCache = new VcnCacheEntry[kVcnCacheSize];
+	flushVcnCache();
 
 	_lvlShapeTop = new int16[18];
 	memset(_lvlShapeTop, 0, 18 * sizeof(int16));
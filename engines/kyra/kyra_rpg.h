@@ -192,6 +192,8 @@ protected:
 	void assignVisibleBlocks(int block, int direction);
 	bool checkSceneUpdateNeed(int block);
 	void drawVcnBlocks();
+	void renderVcnBlocks(uint8 *dst);
+	void flushVcnCache();
 	uint16 calcNewBlockPosition(uint16 curBlock, uint16 direction);
 
 	virtual int clickedDoorSwitch(uint16 block, uint16 direction) = 0;
@@ -228,10 +230,29 @@ protected:
 	uint8 *_vcnShift;
 	uint8 *_vcnColTable;
 	uint16 *_blockDrawingBuffer;
-	uint8 *_sceneWindowBuffer;
 	uint8 _blockBrightness;
 	uint8 _wllVcnOffset;
 
+	// Rendered scene windows, keyed by everything renderVcnBlocks() depends on.
+	// Turning back and forth or redrawing an unchanged view (e.g. when only
+	// decorations or monsters moved) then only costs a copy.
+	struct VcnCacheEntry {
+		uint32 hash;
+		uint32 lastUse;
+		uint8 blockBrightness;
+		uint8 wllVcnOffset;
+		uint16 blocks[660];
+		uint8 colTable[128];
+		uint8 pixels[21120];
+	};
+
+	enum {
+		kVcnCacheSize = 8
+	};
+
+	VcnCacheEntry *_vcnCache;
+	uint32 _vcnCacheCounter;
+
 	uint8 **_doorShapes;
 
 	uint8 _currentLevel;
@@ -317,6 +317,8 @@ void EoBCoreEngine::loadVcnData(const char *file, const uint8 *cgaMapping) {
 			memcpy(_vcnColTable, colMap, 32);
 		memcpy(_vcnBlocks, pos, vcnSize);
 	}
+
+	flushVcnCache();
 }
 
 void EoBCoreEngine::loadBlockProperties(const char *mazFile) {
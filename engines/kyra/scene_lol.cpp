@@ -389,6 +389,7 @@ void LoLEngine::loadLevelGraphics(const char *file, int specialColor, int weight
 
 	memcpy(_vcnBlocks, v, vcnLen);
 	v += vcnLen;
+	flushVcnCache();
 
 	fname = Common::String::format("%s.VMP", _lastBlockDataFile);
 	_screen->loadBitmap(fname.c_str(), 3, 3, 0);
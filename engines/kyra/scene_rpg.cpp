@@ -346,7 +346,47 @@ bool KyraRpgEngine::checkSceneUpdateNeed(int block) {
 }
 
 void KyraRpgEngine::drawVcnBlocks() {
-	uint8 *d = _sceneWindowBuffer;
+	// renderVcnBlocks() reads both the wall and the floor/ceiling half of the block drawing buffer
+	uint32 hash = 0;
+	for (int i = 0; i < 660; i++)
+		hash = hash * 31 + _blockDrawingBuffer[i];
+
+	VcnCacheEntry *entry = 0;
+	VcnCacheEntry *oldest = &_vcnCache[0];
+
+	for (int i = 0; i < kVcnCacheSize; i++) {
+		VcnCacheEntry *e = &_vcnCache[i];
+		if (e->lastUse && e->hash == hash && e->blockBrightness == _blockBrightness && e->wllVcnOffset == _wllVcnOffset
+		        && !memcmp(e->blocks, _blockDrawingBuffer, sizeof(e->blocks)) && !memcmp(e->colTable, _vcnColTable, sizeof(e->colTable))) {
+			entry = e;
+			break;
+		}
+
+		if (e->lastUse < oldest->lastUse)
+			oldest = e;
+	}
+
+	if (!entry) {
+		entry = oldest;
+		entry->hash = hash;
+		entry->blockBrightness = _blockBrightness;
+		entry->wllVcnOffset = _wllVcnOffset;
+		memcpy(entry->blocks, _blockDrawingBuffer, sizeof(entry->blocks));
+		memcpy(entry->colTable, _vcnColTable, sizeof(entry->colTable));
+		renderVcnBlocks(entry->pixels);
+	}
+
+	entry->lastUse = ++_vcnCacheCounter;
+	screen()->copyBlockToPage(_sceneDrawPage1, _sceneXoffset, 0, 176, 120, entry->pixels);
+}
+
+void KyraRpgEngine::flushVcnCache() {
+	for (int i = 0; i < kVcnCacheSize; i++)
+		_vcnCache[i].lastUse = 0;
+}
+
+void KyraRpgEngine::renderVcnBlocks(uint8 *dst) {
+	uint8 *d = dst;
 	uint16 *bdb = _blockDrawingBuffer;
 
 	for (int y = 0; y < 15; y++) {
@@ -476,8 +516,6 @@ void KyraRpgEngine::drawVcnBlocks() {
 		}
 		d += 1232;
 	}
-
-	screen()->copyBlockToPage(_sceneDrawPage1, _sceneXoffset, 0, 176, 120, _sceneWindowBuffer);
 }
 
 uint16 KyraRpgEngine::calcNewBlockPosition(uint16 curBlock, uint16 direction) {
@@ -1509,6 +1509,30 @@ void Screen::drawShape(uint8 pageNum, const uint8 *shapeData, int x, int y, int
 		return;
 	}
 
+	// Use a line function with the plotting method inlined, unless the
+	// plotting method may change from line to line
+	if (dsPlot2 == dsPlot3) {
+		switch (ppc) {
+		case 0:
+			_dsProcessLine = drawShapeLineFunc<&Screen::drawShapePlotType0>(drawFunc);
+			break;
+		case 1:
+			_dsProcessLine = drawShapeLineFunc<&Screen::drawShapePlotType1>(drawFunc);
+			break;
+		case 4:
+			_dsProcessLine = drawShapeLineFunc<&Screen::drawShapePlotType4>(drawFunc);
+			break;
+		case 37:
+			_dsProcessLine = drawShapeLineFunc<&Screen::drawShapePlotType37>(drawFunc);
+			break;
+		case 52:
+			_dsProcessLine = drawShapeLineFunc<&Screen::drawShapePlotType52>(drawFunc);
+			break;
+		default:
+			break;
+		}
+	}
+
 	int curY = y;
 	const uint8 *src = shapeData;
 	uint8 *dst = _dsDstPage = getPagePtr(pageNum);
@@ -1902,6 +1926,68 @@ void Screen::drawShapeProcessLineScaleDownwind(uint8 *&dst, const uint8 *&src, i
 	cnt = -1;
 }
 
+template<bool downwind, Screen::DsPlotFunc plot>
+void Screen::drawShapeProcessLineNoScale(uint8 *&dst, const uint8 *&src, int &cnt, int16) {
+	do {
+		uint8 c = *src++;
+		if (c) {
+			(this->*plot)(dst, c);
+			dst += downwind ? -1 : 1;
+			cnt--;
+		} else {
+			c = *src++;
+			dst += downwind ? -c : c;
+			cnt -= c;
+		}
+	} while (cnt > 0);
+}
+
+template<bool downwind, Screen::DsPlotFunc plot>
+void Screen::drawShapeProcessLineScale(uint8 *&dst, const uint8 *&src, int &cnt, int16 scaleState) {
+	int c = 0;
+
+	do {
+		if ((scaleState & 0x8000) || !(scaleState & 0xFF00)) {
+			c = *src++;
+			_dsTmpWidth--;
+			if (c) {
+				scaleState += _dsScaleW;
+			} else {
+				_dsTmpWidth++;
+				c = *src++;
+				_dsTmpWidth -= c;
+				int r = c * _dsScaleW + scaleState;
+				dst += downwind ? -(r >> 8) : (r >> 8);
+				cnt -= (r >> 8);
+				scaleState = r & 0xff;
+			}
+		} else if (downwind || scaleState) {
+			(this->*plot)(dst, c);
+			dst += downwind ? -1 : 1;
+			scaleState -= 0x100;
+			cnt--;
+		}
+	} while (cnt > 0);
+
+	cnt = -1;
+}
+
+template<Screen::DsPlotFunc plot>
+Screen::DsLineFunc Screen::drawShapeLineFunc(int drawFunc) {
+	static const DsLineFunc dsLineFunc[] = {
+		&Screen::drawShapeProcessLineNoScale<false, plot>,
+		&Screen::drawShapeProcessLineNoScale<true, plot>,
+		&Screen::drawShapeProcessLineNoScale<false, plot>,
+		&Screen::drawShapeProcessLineNoScale<true, plot>,
+		&Screen::drawShapeProcessLineScale<false, plot>,
+		&Screen::drawShapeProcessLineScale<true, plot>,
+		&Screen::drawShapeProcessLineScale<false, plot>,
+		&Screen::drawShapeProcessLineScale<true, plot>
+	};
+
+	return dsLineFunc[drawFunc];
+}
+
 void Screen::drawShapePlotType0(uint8 *dst, uint8 cmd) {
 	*dst = cmd;
 }
@@ -656,6 +656,15 @@ protected:
 	typedef void (Screen::*DsLineFunc)(uint8 *&dst, const uint8 *&src, int &cnt, int16 scaleState);
 	typedef void (Screen::*DsPlotFunc)(uint8 *dst, uint8 cmd);
 
+	// line functions with the plotting method bound at compile time, used for the
+	// most common plot types instead of calling _dsPlot for every pixel
+	template<bool downwind, DsPlotFunc plot>
+	void drawShapeProcessLineNoScale(uint8 *&dst, const uint8 *&src, int &cnt, int16 scaleState);
+	template<bool downwind, DsPlotFunc plot>
+	void drawShapeProcessLineScale(uint8 *&dst, const uint8 *&src, int &cnt, int16 scaleState);
+	template<DsPlotFunc plot>
+	static DsLineFunc drawShapeLineFunc(int drawFunc);
+
 	DsMarginSkipFunc _dsProcessMargin;
 	DsMarginSkipFunc _dsScaleSkip;
 	DsLineFunc _dsProcessLine;
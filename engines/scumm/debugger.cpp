@@ -20,6 +20,7 @@
  *
  */
 
+#include "common/algorithm.h"
 #include "common/debug-channels.h"
 #include "common/file.h"
 #include "common/str.h"
@@ -78,6 +79,7 @@ ScummDebugger::ScummDebugger(ScummEngine *s)
 	DCmd_Register("script",    WRAP_METHOD(ScummDebugger, Cmd_Script));
 	DCmd_Register("scr",       WRAP_METHOD(ScummDebugger, Cmd_Script));
 	DCmd_Register("scripts",   WRAP_METHOD(ScummDebugger, Cmd_PrintScript));
+	DCmd_Register("profile",   WRAP_METHOD(ScummDebugger, Cmd_Profile));
 	DCmd_Register("importres", WRAP_METHOD(ScummDebugger, Cmd_ImportRes));
 
 	if (_vm->_game.id == GID_LOOM)
@@ -330,6 +332,55 @@ bool ScummDebugger::Cmd_PrintScript(int argc, const char **argv) {
 	return true;
 }
 
+struct ProfileEntry {
+	uint16 id;
+	uint32 count;
+
+	bool operator<(const ProfileEntry &x) const { return count > x.count; }
+};
+
+bool ScummDebugger::Cmd_Profile(int argc, const char **argv) {
+	if (argc == 2) {
+		if (!strcmp(argv[1], "on")) {
+			_vm->_profileScripts = true;
+			DebugPrintf("Script profiling on\n");
+		} else if (!strcmp(argv[1], "off")) {
+			_vm->_profileScripts = false;
+			DebugPrintf("Script profiling off\n");
+		} else if (!strcmp(argv[1], "reset")) {
+			_vm->resetScriptProfile();
+			DebugPrintf("Script profile cleared\n");
+		} else {
+			DebugPrintf("Syntax: profile [on|off|reset]\n");
+		}
+		return true;
+	}
+
+	Common::Array<ProfileEntry> opcodes, scripts;
+	for (int i = 0; i < 256; i++) {
+		if (_vm->_opcodeProfile[i]) {
+			ProfileEntry e = { (uint16)i, _vm->_opcodeProfile[i] };
+			opcodes.push_back(e);
+		}
+	}
+	for (Common::HashMap<uint16, uint32>::const_iterator i = _vm->_scriptProfile.begin(); i != _vm->_scriptProfile.end(); ++i) {
+		ProfileEntry e = { i->_key, i->_value };
+		scripts.push_back(e);
+	}
+	Common::sort(opcodes.begin(), opcodes.end());
+	Common::sort(scripts.begin(), scripts.end());
+
+	DebugPrintf("Script profiling is %s\n", _vm->_profileScripts ? "on" : "off");
+	DebugPrintf("Top opcodes:\n");
+	for (uint i = 0; i < opcodes.size() && i < 16; i++)
+		DebugPrintf("  [%02X] %-24s %u\n", opcodes[i].id, _vm->getOpcodeDesc(opcodes[i].id), opcodes[i].count);
+	DebugPrintf("Top scripts:\n");
+	for (uint i = 0; i < scripts.size() && i < 16; i++)
+		DebugPrintf("  %4d %u\n", scripts[i].id, scripts[i].count);
+
+	return true;
+}
+
 bool ScummDebugger::Cmd_Actor(int argc, const char **argv) {
 	Actor *a;
 	int actnum;
@@ -33,7 +33,14 @@ namespace Scumm {
 #pragma mark --- ScummFile ---
 #pragma mark -
 
-ScummFile::ScummFile() : _subFileStart(0), _subFileLen(0) {
+ScummFile::ScummFile(bool preload) : _subFileStart(0), _subFileLen(0), _myEos(false),
+	_preload(preload), _image(0), _imageSize(0) {
+}
+
+ScummFile::~ScummFile() {
+	// Close first, the stream might still refer to the image
+	close();
+	free(_image);
 }
 
 void ScummFile::setSubfileRange(int32 start, int32 len) {
@@ -53,6 +60,11 @@ void ScummFile::resetSubfile() {
 }
 
 bool ScummFile::open(const Common::String &filename) {
+	if (_preload && openImage(filename)) {
+		resetSubfile();
+		return true;
+	}
+
 	if (File::open(filename)) {
 		resetSubfile();
 		return true;
@@ -61,6 +73,28 @@ bool ScummFile::open(const Common::String &filename) {
 	}
 }
 
+bool ScummFile::openImage(const Common::String &filename) {
+	if (!_image || !_imageName.equalsIgnoreCase(filename)) {
+		Common::File file;
+		if (!file.open(filename))
+			return false;
+
+		free(_image);
+		_imageName.clear();
+		_imageSize = file.size();
+		_image = (byte *)malloc(_imageSize);
+		if (!_image || file.read(_image, _imageSize) != _imageSize) {
+			warning("ScummFile: Could not preload '%s', reading it from disk", filename.c_str());
+			free(_image);
+			_image = 0;
+			return false;
+		}
+		_imageName = filename;
+	}
+
+	return File::open(new Common::MemoryReadStream(_image, _imageSize), filename);
+}
+
 bool ScummFile::openSubFile(const Common::String &filename) {
 	assert(isOpen());
 
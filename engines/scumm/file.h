@@ -58,11 +58,24 @@ private:
 	int32	_subFileLen;
 	bool	_myEos; // Have we read past the end of the subfile?
 
+	/**
+	 * If set, data files are read into memory as a whole when opened, and
+	 * all further reads are served from that image. The image of the last
+	 * opened file is kept, so reopening it (e.g. on disk changes or for
+	 * container files) does not read it again.
+	 */
+	bool	_preload;
+	Common::String _imageName;
+	byte	*_image;
+	uint32	_imageSize;
+
 	void setSubfileRange(int32 start, int32 len);
 	void resetSubfile();
+	bool openImage(const Common::String &filename);
 
 public:
-	ScummFile();
+	ScummFile(bool preload = false);
+	~ScummFile();
 
 	bool open(const Common::String &filename);
 	bool openSubFile(const Common::String &filename);
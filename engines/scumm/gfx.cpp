@@ -19,6 +19,7 @@
  *
  */
 
+#include "common/config-manager.h"
 #include "common/system.h"
 #include "scumm/actor.h"
 #include "scumm/charset.h"
@@ -43,6 +44,10 @@
 extern "C" void asmDrawStripToScreen(int height, int width, void const* text, void const* src, byte* dst,
 	int vsPitch, int vmScreenWidth, int textSurfacePitch);
 extern "C" void asmCopy8Col(byte* dst, int dstPitch, const byte* src, int height, uint8 bitDepth);
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON__)
+#include <arm_neon.h>
 #endif /* USE_ARM_GFX_ASM */
 
 namespace Scumm {
@@ -56,6 +61,12 @@ static void clear8Col(byte *dst, int dstPitch, int height, uint8 bitDepth);
 
 static void ditherHerc(byte *src, byte *hercbuf, int srcPitch, int *x, int *y, int *width, int *height);
 
+#ifndef USE_ARM_GFX_ASM
+static void composeText8(byte *dst, const byte *src, int srcSkip, const byte *text, int textSkip, int width, int height);
+#endif
+static void composeText16(byte *dst, const byte *src, int srcSkip, int srcBytesPerPixel, const byte *text, int textSkip,
+                          int width, int height, const uint16 *palette);
+
 struct StripTable {
 	int offsets[160];
 	int run[160];
@@ -214,9 +225,12 @@ Gdi::Gdi(ScummEngine *vm) : _vm(vm) {
 	_zbufferDisabled = false;
 	_objectMode = false;
 	_distaff = false;
+	_stripCacheSize = 0;
+	_stripCacheBudget = 0;
 }
 
 Gdi::~Gdi() {
+	flushStripCache();
 }
 
 GdiHE::GdiHE(ScummEngine *vm) : Gdi(vm), _tmskPtr(0) {
@@ -271,9 +285,15 @@ void Gdi::init() {
 		// the backbuf (thus we have to treat the right border seperately).
 		_numStrips += 1;
 	}
+
+	// Budget of the decoded strip cache in KB, 0 disables it
+	int budget = ConfMan.hasKey("strip_cache_size") ? ConfMan.getInt("strip_cache_size") : 1024;
+	_stripCacheBudget = canCacheStrips() ? MAX(budget, 0) * 1024 : 0;
+	flushStripCache();
 }
 
 void Gdi::roomChanged(byte *roomptr) {
+	flushStripCache();
 }
 
 void GdiNES::roomChanged(byte *roomptr) {
@@ -660,60 +680,19 @@ void ScummEngine::drawStripToScreen(VirtScreen *vs, int x, int width, int top, i
 		} else
 #endif
 		if (_outputPixelFormat.bytesPerPixel == 2) {
-			const byte *srcPtr = (const byte *)src;
 			const byte *textPtr = (byte *)_textSurface.getBasePtr(x * m, y * m);
-			byte *dstPtr = _compositeBuf;
-
-			for (int h = 0; h < height * m; ++h) {
-				for (int w = 0; w < width * m; ++w) {
-					uint16 tmp = *textPtr++;
-					if (tmp == CHARSET_MASK_TRANSPARENCY) {
-						tmp = READ_UINT16(srcPtr);
-						WRITE_UINT16(dstPtr, tmp); dstPtr += 2;
-					} else if (_game.heversion != 0) {
-						error ("16Bit Color HE Game using old charset");
-					} else {
-						WRITE_UINT16(dstPtr, _16BitPalette[tmp]); dstPtr += 2;
-					}
-					srcPtr += vs->format.bytesPerPixel;
-				}
-				srcPtr += vsPitch;
-				textPtr += _textSurface.pitch - width * m;
-			}
+
+			// HE games with 16bit color never use the old charset, so they
+			// get no palette for the text pixels.
+			composeText16(_compositeBuf, (const byte *)src, vsPitch, vs->format.bytesPerPixel, textPtr,
+			              _textSurface.pitch - width * m, width * m, height * m,
+			              _game.heversion != 0 ? 0 : _16BitPalette);
 		} else {
 #ifdef USE_ARM_GFX_ASM
 			asmDrawStripToScreen(height, width, text, src, _compositeBuf, vs->pitch, width, _textSurface.pitch);
 #else
-			// We blit four pixels at a time, for improved performance.
-			const uint32 *src32 = (const uint32 *)src;
-			uint32 *dst32 = (uint32 *)_compositeBuf;
-
-			vsPitch >>= 2;
-
-			const uint32 *text32 = (const uint32 *)text;
-			const int textPitch = (_textSurface.pitch - width * m) >> 2;
-			for (int h = height * m; h > 0; --h) {
-				for (int w = width * m; w > 0; w -= 4) {
-					uint32 temp = *text32++;
-
-					// Generate a byte mask for those text pixels (bytes) with
-					// value CHARSET_MASK_TRANSPARENCY. In the end, each byte
-					// in mask will be either equal to 0x00 or 0xFF.
-					// Doing it this way avoids branches and bytewise operations,
-					// at the cost of readability ;).
-					uint32 mask = temp ^ CHARSET_MASK_TRANSPARENCY_32;
-					mask = (((mask & 0x7f7f7f7f) + 0x7f7f7f7f) | mask) & 0x80808080;
-					mask = ((mask >> 7) + 0x7f7f7f7f) ^ 0x80808080;
-
-					// The following line is equivalent to this code:
-					//   *dst32++ = (*src32++ & mask) | (temp & ~mask);
-					// However, some compilers can generate somewhat better
-					// machine code for this equivalent statement:
-					*dst32++ = ((temp ^ *src32++) & mask) ^ temp;
-				}
-				src32 += vsPitch;
-				text32 += textPitch;
-			}
+			composeText8(_compositeBuf, (const byte *)src, vsPitch, (const byte *)text,
+			             _textSurface.pitch - width * m, width * m, height * m);
 #endif
 		}
 		src = _compositeBuf;
@@ -766,6 +745,120 @@ void ScummEngine::drawStripToScreen(VirtScreen *vs, int x, int width, int top, i
 	_system->copyRectToScreen(src, pitch, x, y, width, height);
 }
 
+#ifndef USE_ARM_GFX_ASM
+/**
+ * Compose the text surface over 8bit game graphics: every text pixel equal
+ * to CHARSET_MASK_TRANSPARENCY is replaced by the matching source pixel.
+ * Width is a multiple of 4; srcSkip and textSkip are the bytes to skip at
+ * the end of each line of the respective buffer.
+ */
+static void composeText8(byte *dst, const byte *src, int srcSkip, const byte *text, int textSkip, int width, int height) {
+#if defined(__SSE2__)
+	const __m128i transparent = _mm_set1_epi8((char)CHARSET_MASK_TRANSPARENCY);
+#elif defined(__ARM_NEON__)
+	const uint8x16_t transparent = vdupq_n_u8(CHARSET_MASK_TRANSPARENCY);
+#endif
+
+	for (int h = height; h > 0; --h) {
+		int w = width;
+
+#if defined(__SSE2__)
+		for (; w >= 16; w -= 16) {
+			const __m128i t = _mm_loadu_si128((const __m128i *)text);
+			const __m128i s = _mm_loadu_si128((const __m128i *)src);
+			const __m128i mask = _mm_cmpeq_epi8(t, transparent);
+			_mm_storeu_si128((__m128i *)dst, _mm_or_si128(_mm_and_si128(mask, s), _mm_andnot_si128(mask, t)));
+			dst += 16;
+			src += 16;
+			text += 16;
+		}
+#elif defined(__ARM_NEON__)
+		for (; w >= 16; w -= 16) {
+			const uint8x16_t t = vld1q_u8(text);
+			const uint8x16_t s = vld1q_u8(src);
+			vst1q_u8(dst, vbslq_u8(vceqq_u8(t, transparent), s, t));
+			dst += 16;
+			src += 16;
+			text += 16;
+		}
+#endif
+
+		// We blit four pixels at a time, for improved performance.
+		for (; w > 0; w -= 4) {
+			uint32 temp = READ_UINT32(text);
+
+			// Generate a byte mask for those text pixels (bytes) with
+			// value CHARSET_MASK_TRANSPARENCY. In the end, each byte
+			// in mask will be either equal to 0x00 or 0xFF.
+			// Doing it this way avoids branches and bytewise operations,
+			// at the cost of readability ;).
+			uint32 mask = temp ^ CHARSET_MASK_TRANSPARENCY_32;
+			mask = (((mask & 0x7f7f7f7f) + 0x7f7f7f7f) | mask) & 0x80808080;
+			mask = ((mask >> 7) + 0x7f7f7f7f) ^ 0x80808080;
+
+			// The following line is equivalent to this code:
+			//   *dst = (*src & mask) | (temp & ~mask);
+			// However, some compilers can generate somewhat better
+			// machine code for this equivalent statement:
+			WRITE_UINT32(dst, ((temp ^ READ_UINT32(src)) & mask) ^ temp);
+			dst += 4;
+			src += 4;
+			text += 4;
+		}
+
+		src += srcSkip;
+		text += textSkip;
+	}
+}
+#endif
+
+/**
+ * Compose the text surface over 16bit game graphics. Transparent text pixels
+ * are replaced by the source pixel, all others are looked up in palette,
+ * which must only be missing if there is no text at all.
+ */
+static void composeText16(byte *dst, const byte *src, int srcSkip, int srcBytesPerPixel, const byte *text, int textSkip,
+                          int width, int height, const uint16 *palette) {
+#ifdef __SSE2__
+	const __m128i transparent = _mm_set1_epi8((char)CHARSET_MASK_TRANSPARENCY);
+#endif
+
+	for (int h = height; h > 0; --h) {
+		int w = width;
+
+#ifdef __SSE2__
+		// Most of the text surface is transparent, so runs of eight
+		// transparent text pixels are copied straight from the source.
+		if (srcBytesPerPixel == 2) {
+			for (; w >= 8; w -= 8) {
+				const __m128i t = _mm_loadl_epi64((const __m128i *)text);
+				if ((_mm_movemask_epi8(_mm_cmpeq_epi8(t, transparent)) & 0xFF) != 0xFF)
+					break;
+				_mm_storeu_si128((__m128i *)dst, _mm_loadu_si128((const __m128i *)src));
+				dst += 16;
+				src += 16;
+				text += 8;
+			}
+		}
+#endif
+
+		for (; w > 0; --w) {
+			const byte color = *text++;
+			if (color == CHARSET_MASK_TRANSPARENCY)
+				WRITE_UINT16(dst, READ_UINT16(src));
+			else if (!palette)
+				error("16Bit Color HE Game using old charset");
+			else
+				WRITE_UINT16(dst, palette[color]);
+			dst += 2;
+			src += srcBytesPerPixel;
+		}
+
+		src += srcSkip;
+		text += textSkip;
+	}
+}
+
 // CGA
 // indy3 loom maniac monkey1 zak
 //
@@ -796,11 +889,20 @@ void ScummEngine::ditherCGA(byte *dst, int dstPitch, int x, int y, int width, in
 		else
 			idx1 = (y + y1) % 2;
 
-		for (int x1 = 0; x1 < width; x1++) {
-			idx2 = (x + x1) % 2;
-			*ptr = cgaDither[idx1][idx2][*ptr & 0xF];
-			ptr++;
+		// Columns alternate between two dither tables, so handle them
+		// pairwise instead of selecting a table for every pixel.
+		idx2 = x % 2;
+		const byte *even = cgaDither[idx1][idx2];
+		const byte *odd = cgaDither[idx1][idx2 ^ 1];
+
+		int x1 = 0;
+		for (; x1 + 1 < width; x1 += 2) {
+			ptr[0] = even[ptr[0] & 0xF];
+			ptr[1] = odd[ptr[1] & 0xF];
+			ptr += 2;
 		}
+		if (x1 < width)
+			*ptr = even[*ptr & 0xF];
 	}
 }
 
@@ -825,9 +927,9 @@ void ditherHerc(byte *src, byte *hercbuf, int srcPitch, int *x, int *y, int *wid
 		dstptr = hercbuf + dsty * kHercWidth + xo * 2;
 
 		const int idx1 = (dsty % 7) % 2;
+		const byte *dither[2] = { cgaDither[idx1][xo % 2], cgaDither[idx1][(xo + 1) % 2] };
 		for (int x1 = 0; x1 < widtho; x1++) {
-			const int idx2 = (xo + x1) % 2;
-			const byte tmp = cgaDither[idx1][idx2][*srcptr & 0xF];
+			const byte tmp = dither[x1 & 1][*srcptr & 0xF];
 			*dstptr++ = tmp >> 1;
 			*dstptr++ = tmp & 0x1;
 			srcptr++;
@@ -1007,7 +1109,7 @@ void ScummEngine::redrawBGStrip(int start, int num) {
 	else
 		room = getResourceAddress(rtRoom, _roomResource);
 
-	_gdi->drawBitmap(room + _IM00_offs, &_virtscr[kMainVirtScreen], s, 0, _roomWidth, _virtscr[kMainVirtScreen].h, s, num, 0);
+	_gdi->drawBitmap(room + _IM00_offs, &_virtscr[kMainVirtScreen], s, 0, _roomWidth, _virtscr[kMainVirtScreen].h, s, num, Gdi::dbCacheStrips);
 }
 
 void ScummEngine::restoreBackground(Common::Rect rect, byte backColor) {
@@ -1769,6 +1871,11 @@ void Gdi::drawBitmap(const byte *ptr, VirtScreen *vs, int x, const int y, const
 	// Check whether lights are turned on or not
 	const bool lightsOn = _vm->isLightOn();
 
+	// Only the room background is cached. Transparent strips depend on what
+	// was drawn before, and masks of flagged draws may be OR'ed, so neither
+	// can be replayed from the cache.
+	const bool useStripCache = _stripCacheBudget && flag == dbCacheStrips;
+
 	if (_vm->_game.features & GF_SMALL_HEADER) {
 		smap_ptr = ptr;
 	} else if (_vm->_game.version == 8) {
@@ -1829,7 +1936,12 @@ void Gdi::drawBitmap(const byte *ptr, VirtScreen *vs, int x, const int y, const
 		else
 			dstPtr = (byte *)vs->pixels + y * vs->pitch + (x * 8 * vs->format.bytesPerPixel);
 
-		transpStrip = drawStrip(dstPtr, vs, x, y, width, height, stripnr, smap_ptr);
+		// Opaque strips of the room background are kept decoded, so that
+		// redrawing them (e.g. when scrolling) is a plain copy.
+		const bool cachedStrip = useStripCache && restoreCachedStrip(dstPtr, vs, x, y, height, stripnr, ptr, numzbuf);
+		if (!cachedStrip)
+			transpStrip = drawStrip(dstPtr, vs, x, y, width, height, stripnr, smap_ptr);
+		const bool opaqueStrip = !transpStrip;
 
 		// COMI and HE games only uses flag value
 		if (_vm->_game.version == 8 || _vm->_game.heversion >= 60)
@@ -1843,7 +1955,11 @@ void Gdi::drawBitmap(const byte *ptr, VirtScreen *vs, int x, const int y, const
 				clear8Col(frontBuf, vs->pitch, height, vs->format.bytesPerPixel);
 		}
 
-		decodeMask(x, y, width, height, stripnr, numzbuf, zplane_list, transpStrip, flag);
+		if (!cachedStrip) {
+			decodeMask(x, y, width, height, stripnr, numzbuf, zplane_list, transpStrip, flag);
+			if (useStripCache && opaqueStrip)
+				storeCachedStrip(dstPtr, vs, x, y, height, stripnr, ptr, numzbuf, zplane_list);
+		}
 
 #if 0
 		// HACK: blit mask(s) onto normal screen. Useful to debug masking
@@ -1871,6 +1987,100 @@ void Gdi::drawBitmap(const byte *ptr, VirtScreen *vs, int x, const int y, const
 	}
 }
 
+bool Gdi::canCacheStrips() const {
+	// EGA and Amiga strips are decoded through a room palette map which may
+	// change while the room is shown.
+	return !(_vm->_game.features & GF_16COLOR) && _vm->_game.platform != Common::kPlatformAmiga;
+}
+
+void Gdi::flushStripCache() {
+	for (StripCache::iterator i = _stripCache.begin(); i != _stripCache.end(); ++i)
+		free(i->_value.data);
+	_stripCache.clear();
+	_stripCacheSize = 0;
+}
+
+bool Gdi::restoreCachedStrip(byte *dstPtr, VirtScreen *vs, int x, int y, const int height,
+					int stripnr, const byte *ptr, int numzbuf) {
+	StripCache::const_iterator i = _stripCache.find(StripCacheKey(ptr, stripnr));
+	if (i == _stripCache.end() || i->_value.height != height || i->_value.numzbuf != numzbuf)
+		return false;
+
+	const StripCacheEntry &entry = i->_value;
+	const int lineSize = 8 * vs->format.bytesPerPixel;
+	const byte *src = entry.data;
+
+	for (int h = 0; h < height; h++) {
+		memcpy(dstPtr, src, lineSize);
+		dstPtr += vs->pitch;
+		src += lineSize;
+	}
+
+	for (int z = 1; z < 9; z++) {
+		if (!(entry.planeMask & (1 << z)))
+			continue;
+
+		byte *mask_ptr = getMaskBuffer(x, y, z);
+		for (int h = 0; h < height; h++) {
+			*mask_ptr = *src++;
+			mask_ptr += _numStrips;
+		}
+	}
+
+	return true;
+}
+
+void Gdi::storeCachedStrip(const byte *dstPtr, VirtScreen *vs, int x, int y, const int height,
+					int stripnr, const byte *ptr, int numzbuf, const byte *zplane_list[9]) {
+	const int lineSize = 8 * vs->format.bytesPerPixel;
+
+	StripCacheEntry entry;
+	entry.height = height;
+	entry.numzbuf = numzbuf;
+	entry.planeMask = 0;
+	entry.size = lineSize * height;
+
+	// Only the planes decodeMask() wrote to are part of the strip
+	for (int z = 1; z < numzbuf; z++) {
+		if (zplane_list[z]) {
+			entry.planeMask |= 1 << z;
+			entry.size += height;
+		}
+	}
+
+	if (_stripCacheSize + entry.size > _stripCacheBudget)
+		return;
+
+	StripCacheKey key(ptr, stripnr);
+	if (_stripCache.contains(key))
+		return;
+
+	entry.data = (byte *)malloc(entry.size);
+	if (!entry.data)
+		return;
+
+	byte *dst = entry.data;
+	for (int h = 0; h < height; h++) {
+		memcpy(dst, dstPtr, lineSize);
+		dstPtr += vs->pitch;
+		dst += lineSize;
+	}
+
+	for (int z = 1; z < numzbuf; z++) {
+		if (!(entry.planeMask & (1 << z)))
+			continue;
+
+		const byte *mask_ptr = getMaskBuffer(x, y, z);
+		for (int h = 0; h < height; h++) {
+			*dst++ = *mask_ptr;
+			mask_ptr += _numStrips;
+		}
+	}
+
+	_stripCache[key] = entry;
+	_stripCacheSize += entry.size;
+}
+
 bool Gdi::drawStrip(byte *dstPtr, VirtScreen *vs, int x, int y, const int width, const int height,
 					int stripnr, const byte *smap_ptr) {
 	// Do some input verification and make sure the strip/strip offset
@@ -24,6 +24,7 @@
 #define SCUMM_GFX_H
 
 #include "common/system.h"
+#include "common/hashmap.h"
 #include "common/list.h"
 
 #include "graphics/surface.h"
@@ -186,6 +187,43 @@ class Gdi {
 protected:
 	ScummEngine *_vm;
 
+	/**
+	 * Key of a decoded strip in the strip cache: the image it was decoded
+	 * from (room background, room image state or object image) and the
+	 * strip number within that image.
+	 */
+	struct StripCacheKey {
+		const byte *ptr;
+		int stripnr;
+
+		StripCacheKey(const byte *p, int nr) : ptr(p), stripnr(nr) {}
+		bool operator==(const StripCacheKey &x) const { return ptr == x.ptr && stripnr == x.stripnr; }
+	};
+
+	struct StripCacheKeyHash {
+		uint operator()(const StripCacheKey &x) const { return (uint)(size_t)x.ptr ^ ((uint)x.stripnr * 2654435761U); }
+	};
+
+	/**
+	 * A decoded strip: 8 pixels per line for 'height' lines, followed by
+	 * 'height' bytes for every z-plane set in 'planeMask'.
+	 */
+	struct StripCacheEntry {
+		int height;
+		int numzbuf;
+		uint16 planeMask;
+		uint32 size;
+		byte *data;
+	};
+
+	typedef Common::HashMap<StripCacheKey, StripCacheEntry, StripCacheKeyHash> StripCache;
+
+	/** Decoded opaque strips of the current room, flushed on every room change. */
+	StripCache _stripCache;
+	uint32 _stripCacheSize;
+	/** Upper bound of _stripCacheSize in bytes; 0 disables the cache. */
+	uint32 _stripCacheBudget;
+
 	byte _paletteMod;
 	byte *_roomPalette;
 	byte _transparentColor;
@@ -232,6 +270,13 @@ protected:
 	/* Misc */
 	int getZPlanes(const byte *smap_ptr, const byte *zplane_list[9], bool bmapImage) const;
 
+	/* Strip cache */
+	virtual bool canCacheStrips() const;
+	bool restoreCachedStrip(byte *dstPtr, VirtScreen *vs, int x, int y, const int height,
+	                int stripnr, const byte *ptr, int numzbuf);
+	void storeCachedStrip(const byte *dstPtr, VirtScreen *vs, int x, int y, const int height,
+	                int stripnr, const byte *ptr, int numzbuf, const byte *zplane_list[9]);
+
 	virtual bool drawStrip(byte *dstPtr, VirtScreen *vs,
 					int x, int y, const int width, const int height,
 					int stripnr, const byte *smap_ptr);
@@ -253,6 +298,8 @@ public:
 	virtual void loadTiles(byte *roomptr);
 	void setTransparentColor(byte transparentColor) { _transparentColor = transparentColor; }
 
+	void flushStripCache();
+
 	void drawBitmap(const byte *ptr, VirtScreen *vs, int x, int y, const int width, const int height,
 	                int stripnr, int numstrip, byte flag);
 
@@ -270,7 +317,8 @@ public:
 	enum DrawBitmapFlags {
 		dbAllowMaskOr   = 1 << 0,
 		dbDrawMaskOnAll = 1 << 1,
-		dbObjectMode    = 2 << 2
+		dbObjectMode    = 2 << 2,
+		dbCacheStrips   = 1 << 4
 	};
 };
 
@@ -309,6 +357,8 @@ protected:
 	void drawStripNES(byte *dst, byte *mask, int dstPitch, int stripnr, int top, int height);
 	void drawStripNESMask(byte *dst, int stripnr, int top, int height) const;
 
+	virtual bool canCacheStrips() const { return false; }
+
 	virtual bool drawStrip(byte *dstPtr, VirtScreen *vs,
 					int x, int y, const int width, const int height,
 					int stripnr, const byte *smap_ptr);
@@ -352,6 +402,8 @@ protected:
 	void drawStripPCEngine(byte *dst, byte *mask, int dstPitch, int stripnr, int top, int height);
 	void drawStripPCEngineMask(byte *dst, int stripnr, int top, int height) const;
 
+	virtual bool canCacheStrips() const { return false; }
+
 	virtual bool drawStrip(byte *dstPtr, VirtScreen *vs,
 					int x, int y, const int width, const int height,
 					int stripnr, const byte *smap_ptr);
@@ -389,6 +441,8 @@ protected:
 	void drawStripV1Background(byte *dst, int dstPitch, int stripnr, int height);
 	void drawStripV1Mask(byte *dst, int stripnr, int width, int height) const;
 
+	virtual bool canCacheStrips() const { return false; }
+
 	virtual bool drawStrip(byte *dstPtr, VirtScreen *vs,
 					int x, int y, const int width, const int height,
 					int stripnr, const byte *smap_ptr);
@@ -415,6 +469,8 @@ protected:
 protected:
 	StripTable *generateStripTable(const byte *src, int width, int height, StripTable *table) const;
 
+	virtual bool canCacheStrips() const { return false; }
+
 	virtual bool drawStrip(byte *dstPtr, VirtScreen *vs,
 					int x, int y, const int width, const int height,
 					int stripnr, const byte *smap_ptr);
@@ -438,6 +494,8 @@ public:
 class GdiHE16bit : public GdiHE {
 protected:
 	virtual void writeRoomColor(byte *dst, byte color) const;
+	// The 16bit palette may change while the room is shown
+	virtual bool canCacheStrips() const { return false; }
 public:
 	GdiHE16bit(ScummEngine *vm);
 };
@@ -735,6 +735,14 @@ void Wiz::decompress16BitWizImage(uint8 *dst, int dstPitch, int dstType, const u
 		dstInc = -2;
 	}
 
+	// Unflipped copies whose destination uses the same byte order as the
+	// image data can handle whole runs at once.
+#ifdef SCUMM_LITTLE_ENDIAN
+	const bool copyRuns = (type == kWizCopy && dstInc == 2);
+#else
+	const bool copyRuns = (type == kWizCopy && dstInc == 2 && (dstType == kDstMemory || dstType == kDstResource));
+#endif
+
 	while (h--) {
 		xoff = srcRect.left;
 		w = srcRect.width();
@@ -770,9 +778,16 @@ void Wiz::decompress16BitWizImage(uint8 *dst, int dstPitch, int dstType, const u
 					if (w < 0) {
 						code += w;
 					}
-					while (code--) {
-						write16BitColor<type>(dstPtr, dataPtr, dstType, xmapPtr);
-						dstPtr += dstInc;
+					if (copyRuns && code) {
+						memcpy(dstPtr, dataPtr, 2);
+						for (int i = 1; i < code; i++)
+							WRITE_UINT16(dstPtr + i * 2, READ_UINT16(dstPtr));
+						dstPtr += code * 2;
+					} else {
+						while (code--) {
+							write16BitColor<type>(dstPtr, dataPtr, dstType, xmapPtr);
+							dstPtr += dstInc;
+						}
 					}
 					dataPtr += 2;
 				} else {
@@ -790,10 +805,16 @@ void Wiz::decompress16BitWizImage(uint8 *dst, int dstPitch, int dstType, const u
 					if (w < 0) {
 						code += w;
 					}
-					while (code--) {
-						write16BitColor<type>(dstPtr, dataPtr, dstType, xmapPtr);
-						dataPtr += 2;
-						dstPtr += dstInc;
+					if (copyRuns) {
+						memcpy(dstPtr, dataPtr, code * 2);
+						dataPtr += code * 2;
+						dstPtr += code * 2;
+					} else {
+						while (code--) {
+							write16BitColor<type>(dstPtr, dataPtr, dstType, xmapPtr);
+							dataPtr += 2;
+							dstPtr += dstInc;
+						}
 					}
 				}
 			}
@@ -869,6 +890,9 @@ void Wiz::decompressWizImage(uint8 *dst, int dstPitch, int dstType, const uint8
 		dstInc = -bitDepth;
 	}
 
+	// Unflipped 8bit copies and remaps can emit whole runs at once.
+	const bool copyRuns = (type != kWizXMap && bitDepth == 1 && dstInc == 1);
+
 	while (h--) {
 		xoff = srcRect.left;
 		w = srcRect.width();
@@ -904,9 +928,14 @@ void Wiz::decompressWizImage(uint8 *dst, int dstPitch, int dstType, const uint8
 					if (w < 0) {
 						code += w;
 					}
-					while (code--) {
-						write8BitColor<type>(dstPtr, dataPtr, dstType, palPtr, xmapPtr, bitDepth);
-						dstPtr += dstInc;
+					if (copyRuns) {
+						memset(dstPtr, (type == kWizRMap) ? palPtr[*dataPtr] : *dataPtr, code);
+						dstPtr += code;
+					} else {
+						while (code--) {
+							write8BitColor<type>(dstPtr, dataPtr, dstType, palPtr, xmapPtr, bitDepth);
+							dstPtr += dstInc;
+						}
 					}
 					dataPtr++;
 				} else {
@@ -924,10 +953,21 @@ void Wiz::decompressWizImage(uint8 *dst, int dstPitch, int dstType, const uint8
 					if (w < 0) {
 						code += w;
 					}
-					while (code--) {
-						write8BitColor<type>(dstPtr, dataPtr, dstType, palPtr, xmapPtr, bitDepth);
-						dataPtr++;
-						dstPtr += dstInc;
+					if (copyRuns && type == kWizCopy) {
+						memcpy(dstPtr, dataPtr, code);
+						dataPtr += code;
+						dstPtr += code;
+					} else if (copyRuns) {
+						for (int i = 0; i < code; i++)
+							dstPtr[i] = palPtr[dataPtr[i]];
+						dataPtr += code;
+						dstPtr += code;
+					} else {
+						while (code--) {
+							write8BitColor<type>(dstPtr, dataPtr, dstType, palPtr, xmapPtr, bitDepth);
+							dataPtr++;
+							dstPtr += dstInc;
+						}
 					}
 				}
 			}
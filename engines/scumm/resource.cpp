@@ -20,6 +20,7 @@
  *
  */
 
+#include "common/algorithm.h"
 #include "common/str.h"
 #ifndef MACOSX
 #include "common/config-manager.h"
@@ -830,6 +831,7 @@ byte *ResourceManager::createResource(ResType type, ResId idx, uint32 size) {
 
 	memset(ptr, 0, size + SAFETY_AREA);
 	_allocatedSize += size;
+	_types[type]._loadCount++;
 
 	_types[type][idx]._address = ptr;
 	_types[type][idx]._size = size;
@@ -862,6 +864,8 @@ void ResourceManager::Resource::nuke() {
 ResourceManager::ResTypeData::ResTypeData() {
 	_mode = kDynamicResTypeMode;
 	_tag = 0;
+	_loadCount = 0;
+	_expiredCount = 0;
 }
 
 ResourceManager::ResTypeData::~ResTypeData() {
@@ -1032,10 +1036,27 @@ void ResourceManager::Resource::setOnHeap() {
 	_status &= ~RF_OFFHEAP;
 }
 
+namespace {
+
+struct ExpireCandidate {
+	byte counter;
+	ResType type;
+	ResId idx;
+
+	// Oldest resources (highest counter) first. Ties are broken the same
+	// way the previous linear search did, so the expiry order is unchanged.
+	bool operator<(const ExpireCandidate &x) const {
+		if (counter != x.counter)
+			return counter > x.counter;
+		if (type != x.type)
+			return type > x.type;
+		return idx < x.idx;
+	}
+};
+
+} // End of anonymous namespace
+
 void ResourceManager::expireResources(uint32 size) {
-	byte best_counter;
-	ResType best_type;
-	int best_res = 0;
 	uint32 oldAllocatedSize;
 
 	if (_expireCounter != 0xFF) {
@@ -1048,31 +1069,32 @@ void ResourceManager::expireResources(uint32 size) {
 
 	oldAllocatedSize = _allocatedSize;
 
-	do {
-		best_type = rtInvalid;
-		best_counter = 2;
-
-		for (ResType type = rtFirst; type <= rtLast; type = ResType(type + 1)) {
-			if (_types[type]._mode != kDynamicResTypeMode) {
-				// Resources of this type can be reloaded from the data files,
-				// so we can potentially unload them to free memory.
-				ResId idx = _types[type].size();
-				while (idx-- > 0) {
-					Resource &tmp = _types[type][idx];
-					byte counter = tmp.getResourceCounter();
-					if (!tmp.isLocked() && counter >= best_counter && tmp._address && !_vm->isResourceInUse(type, idx) && !tmp.isOffHeap()) {
-						best_counter = counter;
-						best_type = type;
-						best_res = idx;
-					}
+	// Gather everything which can be reloaded from the data files in a
+	// single pass, and throw it out oldest first until we are below the
+	// lower threshold again.
+	Common::Array<ExpireCandidate> candidates;
+	for (ResType type = rtFirst; type <= rtLast; type = ResType(type + 1)) {
+		if (_types[type]._mode != kDynamicResTypeMode) {
+			ResId idx = _types[type].size();
+			while (idx-- > 0) {
+				Resource &tmp = _types[type][idx];
+				byte counter = tmp.getResourceCounter();
+				if (!tmp.isLocked() && counter >= 2 && tmp._address && !_vm->isResourceInUse(type, idx) && !tmp.isOffHeap()) {
+					ExpireCandidate candidate = { counter, type, idx };
+					candidates.push_back(candidate);
 				}
 			}
 		}
+	}
 
-		if (!best_type)
+	Common::sort(candidates.begin(), candidates.end());
+
+	for (uint i = 0; i < candidates.size(); i++) {
+		_types[candidates[i].type]._expiredCount++;
+		nukeResource(candidates[i].type, candidates[i].idx);
+		if (size + _allocatedSize <= _minHeapThreshold)
 			break;
-		nukeResource(best_type, best_res);
-	} while (size + _allocatedSize > _minHeapThreshold);
+	}
 
 	increaseResourceCounters();
 
@@ -1133,7 +1155,23 @@ void ResourceManager::resourceStats() {
 		}
 	}
 
-	debug(1, "Total allocated size=%d, locked=%d(%d)", _allocatedSize, lockedSize, lockedNum);
+	debug(1, "Total allocated size=%d, locked=%d(%d), heap threshold=%d..%d",
+			_allocatedSize, lockedSize, lockedNum, _minHeapThreshold, _maxHeapThreshold);
+
+	for (ResType type = rtFirst; type <= rtLast; type = ResType(type + 1)) {
+		uint32 size = 0, num = 0;
+		ResId idx = _types[type].size();
+		while (idx-- > 0) {
+			if (_types[type][idx]._address) {
+				size += _types[type][idx]._size;
+				num++;
+			}
+		}
+
+		if (num || _types[type]._loadCount)
+			debug(1, "  %-12s size=%d(%d), loaded=%d, expired=%d", nameOfResType(type), size, num,
+					_types[type]._loadCount, _types[type]._expiredCount);
+	}
 }
 
 void ScummEngine_v5::readMAXS(int blockSize) {
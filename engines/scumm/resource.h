@@ -164,6 +164,13 @@ public:
 		 */
 		uint32 _tag;
 
+		/**
+		 * How often resources of this type were allocated resp. expired,
+		 * as reported by resourceStats().
+		 */
+		uint32 _loadCount;
+		uint32 _expiredCount;
+
 	public:
 		ResTypeData();
 		~ResTypeData();
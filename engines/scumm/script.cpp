@@ -481,19 +481,30 @@ void ScummEngine::executeScript() {
 			debugN("\n");
 		}
 
+		if (_profileScripts) {
+			_opcodeProfile[_opcode]++;
+			_scriptProfile[vm.slot[_currentScript].number]++;
+		}
+
 		executeOpcode(_opcode);
 
 	}
 }
 
 void ScummEngine::executeOpcode(byte i) {
-	if (_opcodes[i].proc && _opcodes[i].proc->isValid())
-		(*_opcodes[i].proc)();
+	const OpcodeProc proc = _opcodes[i].proc;
+	if (proc)
+		(this->*proc)();
 	else {
 		error("Invalid opcode '%x' at %lx", i, (long)(_scriptPointer - _scriptOrgPointer));
 	}
 }
 
+void ScummEngine::resetScriptProfile() {
+	memset(_opcodeProfile, 0, sizeof(_opcodeProfile));
+	_scriptProfile.clear();
+}
+
 const char *ScummEngine::getOpcodeDesc(byte i) {
 #ifndef REDUCE_MEMORY_USAGE
 	return _opcodes[i].desc;
@@ -529,6 +529,8 @@ ScummEngine::ScummEngine(OSystem *syst, const DetectorResult &dr)
 
 	_hexdumpScripts = false;
 	_showStack = false;
+	_profileScripts = false;
+	resetScriptProfile();
 
 	if (_game.platform == Common::kPlatformFMTowns && _game.version == 3) {	// FM-TOWNS V3 games use 320x240
 		_screenWidth = 320;
@@ -1024,6 +1026,10 @@ Common::Error ScummEngine::init() {
 #endif
 
 
+	// Optionally read the resource data files into memory as a whole, so that
+	// loading resources later on does not hit the disk anymore.
+	const bool preloadResources = ConfMan.hasKey("preload_resources") && ConfMan.getBool("preload_resources");
+
 	// The	kGenUnchanged method is only used for 'container files', i.e. files
 	// that contain the real game files bundled together in an archive format.
 	// This is the case of the NES, v0 and Mac versions of certain games.
@@ -1079,7 +1085,7 @@ Common::Error ScummEngine::init() {
 			// code in openResourceFile() (and in the Sound class, for MONSTER.SOU
 			// handling).
 			assert(_game.version >= 5 && _game.heversion == 0);
-			_fileHandle = new ScummFile();
+			_fileHandle = new ScummFile(preloadResources);
 			_containerFile = _filenamePattern.pattern;
 
 
@@ -1129,7 +1135,7 @@ Common::Error ScummEngine::init() {
 		}
 	} else {
 		// Regular access, no container file involved
-		_fileHandle = new ScummFile();
+		_fileHandle = new ScummFile(preloadResources);
 	}
 
 	// Load CJK font, if present
@@ -1310,7 +1316,17 @@ void ScummEngine::setupScumm() {
 		maxHeapThreshold = 550000;
 	}
 
-	_res->setHeapThreshold(400000, maxHeapThreshold);
+	int minHeapThreshold = 400000;
+
+	// The defaults above date back to machines with a few MB of memory; on
+	// request keep as many resources loaded as fit into the given budget (in
+	// KB), and only expire down to three quarters of it.
+	if (ConfMan.hasKey("resource_cache_size")) {
+		maxHeapThreshold = MAX(ConfMan.getInt("resource_cache_size"), 1) * 1024;
+		minHeapThreshold = maxHeapThreshold / 4 * 3;
+	}
+
+	_res->setHeapThreshold(minHeapThreshold, maxHeapThreshold);
 
 	free(_compositeBuf);
 	_compositeBuf = (byte *)malloc(_screenWidth * _textSurfaceMultiplier * _screenHeight * _textSurfaceMultiplier * _outputPixelFormat.bytesPerPixel);
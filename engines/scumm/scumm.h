@@ -28,6 +28,7 @@
 #include "common/endian.h"
 #include "common/events.h"
 #include "common/file.h"
+#include "common/hashmap.h"
 #include "common/savefile.h"
 #include "common/keyboard.h"
 #include "common/random.h"
@@ -587,6 +588,12 @@ protected:
 	bool _showStack;
 	uint16 _debugMode;
 
+	// Opcode and script execution counts, collected while _profileScripts is set
+	bool _profileScripts;
+	uint32 _opcodeProfile[256];
+	Common::HashMap<uint16, uint32> _scriptProfile;
+	void resetScriptProfile();
+
 	// Save/Load class - some of this may be GUI
 	byte _saveLoadFlag, _saveLoadSlot;
 	uint32 _lastSaveTime;
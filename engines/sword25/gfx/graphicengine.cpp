@@ -60,6 +60,8 @@ enum {
 
 namespace Sword25 {
 
+static const uint PRECACHE_TIME_PER_FRAME = 5;      // Milliseconds per frame spent loading precached resources
+static const uint VECTORIMAGE_RASTER_CACHE_SIZE = 16 * 1024 * 1024; // Bytes of vector image rasterizations to keep
 static const uint FRAMETIME_SAMPLE_COUNT = 5;       // Anzahl der Framezeiten ber die, die Framezeit gemittelt wird
 
 GraphicEngine::GraphicEngine(Kernel *pKernel) :
@@ -70,6 +72,7 @@ GraphicEngine::GraphicEngine(Kernel *pKernel) :
 	_lastFrameDuration(0),
 	_timerActive(true),
 	_frameTimeSampleSlot(0),
+	_vectorImageRasterSize(0),
 	_thumbnail(NULL),
 	ResourceService(pKernel) {
 	_frameTimeSamples.resize(FRAMETIME_SAMPLE_COUNT);
@@ -82,6 +85,10 @@ GraphicEngine::GraphicEngine(Kernel *pKernel) :
 
 GraphicEngine::~GraphicEngine() {
 	unregisterScriptBindings();
+
+	for (Common::List<VectorImageRaster>::iterator it = _vectorImageRasters.begin(); it != _vectorImageRasters.end(); ++it)
+		delete it->_raster;
+
 	_backSurface.free();
 	delete _thumbnail;
 }
@@ -107,6 +114,7 @@ bool GraphicEngine::init(int width, int height, int bitDepth, int backbufferCoun
 	_screenRect.top = 0;
 	_screenRect.right = _width;
 	_screenRect.bottom = _height;
+	_clipRect = _screenRect;
 
 	const Graphics::PixelFormat format = g_system->getScreenFormat();
 
@@ -135,19 +143,28 @@ bool GraphicEngine::startFrame(bool updateAll) {
 	// Den Layer-Manager auf den nchsten Frame vorbereiten
 	_renderObjectManagerPtr->startFrame();
 
+	if (updateAll)
+		_renderObjectManagerPtr->invalidate();
+
 	return true;
 }
 
 bool GraphicEngine::endFrame() {
 #ifndef THEORA_INDIRECT_RENDERING
-	if (Kernel::getInstance()->getFMV()->isMovieLoaded())
+	if (Kernel::getInstance()->getFMV()->isMovieLoaded()) {
+		// The movie is drawn directly to the screen, so everything has to be redrawn afterwards
+		_renderObjectManagerPtr->invalidate();
 		return true;
+	}
 #endif
 
 	_renderObjectManagerPtr->render();
 
 	g_system->updateScreen();
 
+	// Use some of the time between frames to load the resources the scripts asked to precache
+	Kernel::getInstance()->getResourceManager()->precacheQueued(PRECACHE_TIME_PER_FRAME);
+
 	return true;
 }
 
@@ -165,6 +182,57 @@ bool GraphicEngine::getVsync() const {
 	return true;
 }
 
+RenderedImage *GraphicEngine::getVectorImageRaster(VectorImage *image, int width, int height) {
+	for (Common::List<VectorImageRaster>::iterator it = _vectorImageRasters.begin(); it != _vectorImageRasters.end(); ++it) {
+		if (it->_image == image && it->_width == width && it->_height == height) {
+			// Move the rasterization to the front of the list
+			if (it != _vectorImageRasters.begin()) {
+				VectorImageRaster raster = *it;
+				_vectorImageRasters.erase(it);
+				_vectorImageRasters.push_front(raster);
+			}
+			return _vectorImageRasters.front()._raster;
+		}
+	}
+
+	const uint size = width * height * 4;
+
+	// Drop the least recently used rasterizations to stay within the budget
+	while (!_vectorImageRasters.empty() && _vectorImageRasterSize + size > VECTORIMAGE_RASTER_CACHE_SIZE) {
+		VectorImageRaster &oldest = _vectorImageRasters.back();
+		_vectorImageRasterSize -= oldest._width * oldest._height * 4;
+		delete oldest._raster;
+		_vectorImageRasters.pop_back();
+	}
+
+	byte *pixelData = new byte[size];
+	Common::fill(pixelData, pixelData + size, 0);
+	image->render(pixelData, width, height);
+
+	VectorImageRaster raster;
+	raster._image = image;
+	raster._width = width;
+	raster._height = height;
+	raster._raster = new RenderedImage(pixelData, width, height);
+	_vectorImageRasters.push_front(raster);
+	_vectorImageRasterSize += size;
+
+	return raster._raster;
+}
+
+void GraphicEngine::removeVectorImageRasters(const VectorImage *image) {
+	Common::List<VectorImageRaster>::iterator it = _vectorImageRasters.begin();
+	while (it != _vectorImageRasters.end()) {
+		if (it->_image == image) {
+			_vectorImageRasterSize -= it->_width * it->_height * 4;
+			delete it->_raster;
+			it = _vectorImageRasters.erase(it);
+		} else {
+			++it;
+		}
+	}
+}
+
 bool GraphicEngine::fill(const Common::Rect *fillRectPtr, uint color) {
 	Common::Rect rect(_width - 1, _height - 1);
 
@@ -180,6 +248,7 @@ bool GraphicEngine::fill(const Common::Rect *fillRectPtr, uint color) {
 	if (fillRectPtr) {
 		rect = *fillRectPtr;
 	}
+	rect.clip(_clipRect);
 
 	if (rect.width() > 0 && rect.height() > 0) {
 		if (ca == 0xff) {
@@ -215,8 +284,6 @@ bool GraphicEngine::fill(const Common::Rect *fillRectPtr, uint color) {
 				outo += _backSurface.pitch;
 			}
 		}
-
-		g_system->copyRectToScreen(_backSurface.getBasePtr(rect.left, rect.top), _backSurface.pitch, rect.left, rect.top, rect.width(), rect.height());
 	}
 
 	return true;
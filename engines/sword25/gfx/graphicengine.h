@@ -42,6 +42,7 @@
 
 // Includes
 #include "common/array.h"
+#include "common/list.h"
 #include "common/rect.h"
 #include "common/ptr.h"
 #include "common/str.h"
@@ -57,6 +58,8 @@ namespace Sword25 {
 class Kernel;
 class Image;
 class Panel;
+class RenderedImage;
+class VectorImage;
 class Screenshot;
 class RenderObjectManager;
 
@@ -229,6 +232,34 @@ public:
 	 */
 	bool fill(const Common::Rect *fillRectPtr = 0, uint color = BS_RGB(0, 0, 0));
 
+	/**
+	 * Sets the area of the frame buffer that fill() and image blits may draw to.
+	 * The rectangle is trimmed to the screen.
+	 */
+	void setClipRect(const Common::Rect &clipRect) {
+		_clipRect = clipRect;
+		_clipRect.clip(_screenRect);
+	}
+
+	/**
+	 * Returns the area of the frame buffer that may currently be drawn to
+	 */
+	const Common::Rect &getClipRect() const {
+		return _clipRect;
+	}
+
+	/**
+	 * Returns the given vector image rasterized at the given size. Rasterizations
+	 * are cached, and the least recently used ones are dropped once the cache
+	 * grows beyond its byte budget.
+	 */
+	RenderedImage *getVectorImageRaster(VectorImage *image, int width, int height);
+
+	/**
+	 * Drops all cached rasterizations of the given vector image
+	 */
+	void removeVectorImageRasters(const VectorImage *image);
+
 	Graphics::Surface _backSurface;
 	Graphics::Surface *getSurface() { return &_backSurface; }
 
@@ -290,6 +321,7 @@ protected:
 	int _width;
 	int _height;
 	Common::Rect _screenRect;
+	Common::Rect _clipRect;
 	int _bitDepth;
 
 	/**
@@ -309,6 +341,16 @@ private:
 	Common::Array<uint> _frameTimeSamples;
 	uint _frameTimeSampleSlot;
 
+	// Vector image rasterizations, most recently used first
+	struct VectorImageRaster {
+		const VectorImage *_image;
+		int _width;
+		int _height;
+		RenderedImage *_raster;
+	};
+	Common::List<VectorImageRaster> _vectorImageRasters;
+	uint _vectorImageRasterSize;
+
 private:
 	byte *_backBuffer;
 
@@ -40,8 +40,65 @@
 
 #include "common/system.h"
 
+#if defined(SCUMM_LITTLE_ENDIAN) && defined(__SSE2__)
+#include <emmintrin.h>
+#define SWORD25_BLIT_SSE2
+#endif
+
 namespace Sword25 {
 
+#ifdef SWORD25_BLIT_SSE2
+/**
+ * Blends the leading multiple of 4 pixels of a row without color modulation,
+ * returns how many were done. Gives exactly the same result as the generic
+ * loop in RenderedImage::blit.
+ */
+static int blendRow(const byte *in, byte *out, int width, int inStep) {
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i alphaMask = _mm_set1_epi32((int)0xFF000000);
+	const __m128i full = _mm_set1_epi16(256);
+	int j = 0;
+	for (; j + 4 <= width; j += 4, out += 16) {
+		__m128i src;
+		if (inStep > 0) {
+			src = _mm_loadu_si128((const __m128i *)in);
+		} else {
+			// Flipped, the next 4 pixels are the ones before in
+			src = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)(in - 12)), _MM_SHUFFLE(0, 1, 2, 3));
+		}
+		in += inStep * 4;
+
+		const __m128i srcAlpha = _mm_and_si128(src, alphaMask);
+		const __m128i transparent = _mm_cmpeq_epi32(srcAlpha, zero);
+		if (_mm_movemask_epi8(transparent) == 0xFFFF)
+			continue;
+		const __m128i opaque = _mm_cmpeq_epi32(srcAlpha, alphaMask);
+		if (_mm_movemask_epi8(opaque) == 0xFFFF) {
+			_mm_storeu_si128((__m128i *)out, src);
+			continue;
+		}
+		const __m128i dst = _mm_loadu_si128((const __m128i *)out);
+
+		// out + ((in - out) * a >> 8) is computed as (out * (256 - a) + in * a) >> 8,
+		// which rounds the same way and stays within 16 bits
+		const __m128i srcLo = _mm_unpacklo_epi8(src, zero);
+		const __m128i srcHi = _mm_unpackhi_epi8(src, zero);
+		const __m128i aLo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(srcLo, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+		const __m128i aHi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(srcHi, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+		const __m128i blendLo = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(dst, zero), _mm_sub_epi16(full, aLo)),
+		                                                     _mm_mullo_epi16(srcLo, aLo)), 8);
+		const __m128i blendHi = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(dst, zero), _mm_sub_epi16(full, aHi)),
+		                                                     _mm_mullo_epi16(srcHi, aHi)), 8);
+
+		__m128i result = _mm_or_si128(_mm_packus_epi16(blendLo, blendHi), alphaMask);
+		result = _mm_or_si128(_mm_and_si128(opaque, src), _mm_andnot_si128(opaque, result));
+		result = _mm_or_si128(_mm_and_si128(transparent, dst), _mm_andnot_si128(transparent, result));
+		_mm_storeu_si128((__m128i *)out, result);
+	}
+	return j;
+}
+#endif
+
 // -----------------------------------------------------------------------------
 // CONSTRUCTION / DESTRUCTION
 // -----------------------------------------------------------------------------
@@ -99,7 +156,8 @@ static byte *readSavegameThumbnail(const Common::String &filename, uint &fileSiz
 RenderedImage::RenderedImage(const Common::String &filename, bool &result) :
 	_data(0),
 	_width(0),
-	_height(0) {
+	_height(0),
+	_scaledSurface(0) {
 	result = false;
 
 	PackageManager *pPackage = Kernel::getInstance()->getPackage();
@@ -149,7 +207,8 @@ RenderedImage::RenderedImage(const Common::String &filename, bool &result) :
 
 RenderedImage::RenderedImage(uint width, uint height, bool &result) :
 	_width(width),
-	_height(height) {
+	_height(height),
+	_scaledSurface(0) {
 
 	_data = new byte[width * height * 4];
 	Common::fill(_data, &_data[width * height * 4], 0);
@@ -162,7 +221,17 @@ RenderedImage::RenderedImage(uint width, uint height, bool &result) :
 	return;
 }
 
-RenderedImage::RenderedImage() : _width(0), _height(0), _data(0) {
+RenderedImage::RenderedImage(byte *pixeldata, int width, int height) :
+	_width(width),
+	_height(height),
+	_data(pixeldata),
+	_scaledSurface(0) {
+	_backSurface = Kernel::getInstance()->getGfx()->getSurface();
+
+	_doCleanup = true;
+}
+
+RenderedImage::RenderedImage() : _width(0), _height(0), _data(0), _scaledSurface(0) {
 	_backSurface = Kernel::getInstance()->getGfx()->getSurface();
 
 	_doCleanup = false;
@@ -173,6 +242,8 @@ RenderedImage::RenderedImage() : _width(0), _height(0), _data(0) {
 // -----------------------------------------------------------------------------
 
 RenderedImage::~RenderedImage() {
+	freeScaledSurface();
+
 	if (_doCleanup)
 		delete[] _data;
 }
@@ -193,6 +264,8 @@ bool RenderedImage::setContent(const byte *pixeldata, uint size, uint offset, ui
 		return false;
 	}
 
+	freeScaledSurface();
+
 	const byte *in = &pixeldata[offset];
 	byte *out = _data;
 
@@ -206,6 +279,7 @@ bool RenderedImage::setContent(const byte *pixeldata, uint size, uint offset, ui
 }
 
 void RenderedImage::replaceContent(byte *pixeldata, int width, int height) {
+	freeScaledSurface();
 	_width = width;
 	_height = height;
 	_data = pixeldata;
@@ -271,57 +345,62 @@ bool RenderedImage::blit(int posX, int posY, int flipping, Common::Rect *pPartRe
 	height = height * 2 / 3;
 #endif
 
-	Graphics::Surface *img;
-	Graphics::Surface *imgScaled = NULL;
-	byte *savedPixels = NULL;
+	const Graphics::Surface *img;
 	if ((width != srcImage.w) || (height != srcImage.h)) {
-		// Scale the image
-		img = imgScaled = scale(srcImage, width, height);
-		savedPixels = (byte *)img->pixels;
+		// Scale the image, or reuse the copy scaled by the previous blit
+		Common::Rect partRect = pPartRect ? *pPartRect : Common::Rect(_width, _height);
+		if (!_scaledSurface || _scaledSurface->w != width || _scaledSurface->h != height || _scaledPartRect != partRect) {
+			freeScaledSurface();
+			_scaledSurface = scale(srcImage, width, height);
+			_scaledPartRect = partRect;
+		}
+		img = _scaledSurface;
 	} else {
 		img = &srcImage;
 	}
 
-	// Handle off-screen clipping
-	if (posY < 0) {
-		img->h = MAX(0, (int)img->h - -posY);
-		img->pixels = (byte *)img->pixels + img->pitch * -posY;
-		posY = 0;
-	}
-
-	if (posX < 0) {
-		img->w = MAX(0, (int)img->w - -posX);
-		img->pixels = (byte *)img->pixels + (-posX * 4);
-		posX = 0;
-	}
-
-	img->w = CLIP((int)img->w, 0, (int)MAX((int)_backSurface->w - posX, 0));
-	img->h = CLIP((int)img->h, 0, (int)MAX((int)_backSurface->h - posY, 0));
+	// Clip against the area being redrawn, which never extends past the screen.
+	// The clipping is done in screen space, so that flipped images lose the
+	// correct side.
+	const Common::Rect &clipRect = Kernel::getInstance()->getGfx()->getClipRect();
+	int skipX = MAX(clipRect.left - posX, 0);
+	int skipY = MAX(clipRect.top - posY, 0);
+	int drawWidth = MIN(posX + (int)img->w, (int)clipRect.right) - posX - skipX;
+	int drawHeight = MIN(posY + (int)img->h, (int)clipRect.bottom) - posY - skipY;
 
-	if ((img->w > 0) && (img->h > 0)) {
-		int xp = 0, yp = 0;
+	if ((drawWidth > 0) && (drawHeight > 0)) {
+		int xp = skipX, yp = skipY;
 
 		int inStep = 4;
 		int inoStep = img->pitch;
 		if (flipping & Image::FLIP_V) {
 			inStep = -inStep;
-			xp = img->w - 1;
+			xp = img->w - 1 - skipX;
 		}
 
 		if (flipping & Image::FLIP_H) {
 			inoStep = -inoStep;
-			yp = img->h - 1;
+			yp = img->h - 1 - skipY;
 		}
 
-		byte *ino = (byte *)img->getBasePtr(xp, yp);
-		byte *outo = (byte *)_backSurface->getBasePtr(posX, posY);
-		byte *in, *out;
+		const byte *ino = (const byte *)img->getBasePtr(xp, yp);
+		byte *outo = (byte *)_backSurface->getBasePtr(posX + skipX, posY + skipY);
+		const byte *in;
+		byte *out;
 
-		for (int i = 0; i < img->h; i++) {
+		for (int i = 0; i < drawHeight; i++) {
 			out = outo;
 			in = ino;
-			for (int j = 0; j < img->w; j++) {
-				uint32 pix = *(uint32 *)in;
+			int j = 0;
+#ifdef SWORD25_BLIT_SSE2
+			if (ca == 255 && cr == 255 && cg == 255 && cb == 255) {
+				j = blendRow(in, out, drawWidth, inStep);
+				in += j * inStep;
+				out += j * 4;
+			}
+#endif
+			for (; j < drawWidth; j++) {
+				uint32 pix = *(const uint32 *)in;
 				int b = (pix >> 0) & 0xff;
 				int g = (pix >> 8) & 0xff;
 				int r = (pix >> 16) & 0xff;
@@ -429,20 +508,19 @@ bool RenderedImage::blit(int posX, int posY, int flipping, Common::Rect *pPartRe
 			outo += _backSurface->pitch;
 			ino += inoStep;
 		}
-
-		g_system->copyRectToScreen(_backSurface->getBasePtr(posX, posY), _backSurface->pitch, posX, posY,
-			img->w, img->h);
-	}
-
-	if (imgScaled) {
-		imgScaled->pixels = savedPixels;
-		imgScaled->free();
-		delete imgScaled;
 	}
 
 	return true;
 }
 
+void RenderedImage::freeScaledSurface() {
+	if (_scaledSurface) {
+		_scaledSurface->free();
+		delete _scaledSurface;
+		_scaledSurface = 0;
+	}
+}
+
 void RenderedImage::copyDirectly(int posX, int posY) {
 	byte *data = _data;
 	int w = _width;
@@ -55,6 +55,13 @@ public:
 	                  after the call, do not call methods on the object and destroy the object immediately.
 	*/
 	RenderedImage(uint width, uint height, bool &result);
+
+	/**
+	    @brief Creates a BS_RenderedImage which takes ownership of the given pixel data
+
+	    @param pixeldata The image data in ARGB32 format, allocated with new[]
+	*/
+	RenderedImage(byte *pixeldata, int width, int height);
 	RenderedImage();
 
 	virtual ~RenderedImage();
@@ -113,6 +120,11 @@ private:
 
 	Graphics::Surface *_backSurface;
 
+	// The image scaled by the last scaled blit, and the part of the image it shows
+	Graphics::Surface *_scaledSurface;
+	Common::Rect _scaledPartRect;
+	void freeScaledSurface();
+
 	static int *scaleLine(int size, int srcSize);
 };
 
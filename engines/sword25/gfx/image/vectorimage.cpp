@@ -36,6 +36,7 @@
 #include "sword25/gfx/image/art.h"
 #include "sword25/gfx/image/vectorimage.h"
 #include "sword25/gfx/image/renderedimage.h"
+#include "sword25/kernel/kernel.h"
 
 #include "graphics/colormasks.h"
 
@@ -214,7 +215,7 @@ Common::Rect CalculateBoundingBox(const VectorImageElement &vectorImageElement)
 // Construction
 // -----------------------------------------------------------------------------
 
-VectorImage::VectorImage(const byte *pFileData, uint fileSize, bool &success, const Common::String &fname) : _pixelData(0), _fname(fname) {
+VectorImage::VectorImage(const byte *pFileData, uint fileSize, bool &success, const Common::String &fname) : _fname(fname) {
 	success = false;
 
 	// Create bitstream object
@@ -299,8 +300,10 @@ VectorImage::~VectorImage() {
 			if (_elements[j].getPathInfo(i).getVec())
 				free(_elements[j].getPathInfo(i).getVec());
 
-	if (_pixelData)
-		free(_pixelData);
+	// The graphics engine is gone already when the resources are freed on shutdown
+	GraphicEngine *gfx = Kernel::getInstance()->getGfx();
+	if (gfx)
+		gfx->removeVectorImageRasters(this);
 }
 
 
@@ -603,31 +606,18 @@ bool VectorImage::blit(int posX, int posY,
                        Common::Rect *pPartRect,
                        uint color,
                        int width, int height) {
-	static VectorImage *oldThis = 0;
-	static int              oldWidth = -2;
-	static int              oldHeight = -2;
-
 	// If width or height to 0, nothing needs to be shown.
 	if (width == 0 || height == 0)
 		return true;
 
-	// Determine if the old image in the cache can not be reused and must be recalculated
-	if (!(oldThis == this && oldWidth == width && oldHeight == height)) {
-		render(width, height);
-
-		oldThis = this;
-		oldHeight = height;
-		oldWidth = width;
-	}
-
-	RenderedImage *rend = new RenderedImage();
+	if (width == -1)
+		width = getWidth();
+	if (height == -1)
+		height = getHeight();
 
-	rend->replaceContent(_pixelData, width, height);
-	rend->blit(posX, posY, flipping, pPartRect, color, width, height);
-
-	delete rend;
-
-	return true;
+	// The graphics engine caches the image rasterized at this size
+	RenderedImage *raster = Kernel::getInstance()->getGfx()->getVectorImageRaster(this, width, height);
+	return raster->blit(posX, posY, flipping, pPartRect, color, width, height);
 }
 
 } // End of namespace Sword25
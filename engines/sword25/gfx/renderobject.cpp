@@ -33,6 +33,7 @@
 
 #include "sword25/kernel/outputpersistenceblock.h"
 #include "sword25/kernel/inputpersistenceblock.h"
+#include "sword25/kernel/kernel.h"
 
 #include "sword25/gfx/renderobjectregistry.h"
 #include "sword25/gfx/renderobjectmanager.h"
@@ -96,6 +97,10 @@ RenderObject::RenderObject(RenderObjectPtr<RenderObject> parentPtr, TYPES type,
 }
 
 RenderObject::~RenderObject() {
+	// Den Bereich, den das Objekt zuletzt belegt hat, neu zeichnen lassen.
+	if (_managerPtr && _oldVisible)
+		_managerPtr->addDirtyRect(_oldBbox);
+
 	// Objekt aus dem Elternobjekt entfernen.
 	if (_parentPtr.isValid())
 		_parentPtr->detatchChildren(this->getHandle());
@@ -106,7 +111,7 @@ RenderObject::~RenderObject() {
 	RenderObjectRegistry::instance().deregisterObject(this);
 }
 
-bool RenderObject::render() {
+bool RenderObject::render(const Common::Array<Common::Rect> &updateRects) {
 	// Objektnderungen validieren
 	validateObject();
 
@@ -120,13 +125,19 @@ bool RenderObject::render() {
 		_childChanged = false;
 	}
 
-	// Objekt zeichnen.
-	doRender();
+	// Objekt zeichnen, aber nur in den Bereichen, die neu gezeichnet werden.
+	GraphicEngine *gfxPtr = Kernel::getInstance()->getGfx();
+	for (uint i = 0; i < updateRects.size(); ++i) {
+		if (_bbox.intersects(updateRects[i])) {
+			gfxPtr->setClipRect(updateRects[i]);
+			doRender();
+		}
+	}
 
 	// Dann mssen die Kinder gezeichnet werden
 	RENDEROBJECT_ITER it = _children.begin();
 	for (; it != _children.end(); ++it)
-		if (!(*it)->render())
+		if (!(*it)->render(updateRects))
 			return false;
 
 	return true;
@@ -151,6 +162,14 @@ bool RenderObject::updateObjectState() {
 	        (_y != _oldY) ||
 	        (_z != _oldZ) ||
 	        _refreshForced) {
+		// Den alten und den neuen Bereich des Objektes neu zeichnen lassen.
+		if (_managerPtr) {
+			if (_oldVisible)
+				_managerPtr->addDirtyRect(_oldBbox);
+			if (_visible)
+				_managerPtr->addDirtyRect(calcBoundingBox());
+		}
+
 		// Renderrang des Objektes neu bestimmen, da sich dieser verndert haben knnte
 		if (_parentPtr.isValid())
 			_parentPtr->signalChildChange();
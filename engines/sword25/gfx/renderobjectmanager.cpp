@@ -37,16 +37,22 @@
 #include "sword25/gfx/graphicengine.h"
 #include "sword25/gfx/animationtemplateregistry.h"
 #include "common/rect.h"
+#include "common/system.h"
 #include "sword25/gfx/renderobject.h"
 #include "sword25/gfx/timedrenderobject.h"
 #include "sword25/gfx/rootrenderobject.h"
 
 namespace Sword25 {
 
+// Above this many dirty rects, their bounding box is redrawn instead
+static const uint kMaxDirtyRects = 16;
+
 RenderObjectManager::RenderObjectManager(int width, int height, int framebufferCount) :
-	_frameStarted(false) {
+	_frameStarted(false),
+	_screenRect(width, height) {
 	// Wurzel des BS_RenderObject-Baumes erzeugen.
 	_rootPtr = (new RootRenderObject(this, width, height))->getHandle();
+	invalidate();
 }
 
 RenderObjectManager::~RenderObjectManager() {
@@ -75,8 +81,49 @@ bool RenderObjectManager::render() {
 
 	_frameStarted = false;
 
+	if (_dirtyRects.empty())
+		return true;
+
 	// Die Render-Methode der Wurzel aufrufen. Dadurch wird das rekursive Rendern der Baumelemente angestoen.
-	return _rootPtr->render();
+	// Only the objects that intersect the dirty rects are drawn, clipped to them.
+	bool result = _rootPtr->render(_dirtyRects);
+
+	GraphicEngine *gfxPtr = Kernel::getInstance()->getGfx();
+	gfxPtr->setClipRect(_screenRect);
+
+	const Graphics::Surface *backSurface = gfxPtr->getSurface();
+	for (uint i = 0; i < _dirtyRects.size(); ++i) {
+		const Common::Rect &rect = _dirtyRects[i];
+		g_system->copyRectToScreen(backSurface->getBasePtr(rect.left, rect.top), backSurface->pitch, rect.left, rect.top, rect.width(), rect.height());
+	}
+	_dirtyRects.clear();
+
+	return result;
+}
+
+void RenderObjectManager::addDirtyRect(const Common::Rect &rect) {
+	Common::Rect dirtyRect = rect;
+	dirtyRect.clip(_screenRect);
+	if (!dirtyRect.isValidRect() || dirtyRect.isEmpty())
+		return;
+
+	// Merge the rect with all the rects it overlaps, until it overlaps none
+	for (uint i = 0; i < _dirtyRects.size();) {
+		if (_dirtyRects[i].intersects(dirtyRect)) {
+			dirtyRect.extend(_dirtyRects[i]);
+			_dirtyRects.remove_at(i);
+			i = 0;
+		} else {
+			++i;
+		}
+	}
+	_dirtyRects.push_back(dirtyRect);
+
+	if (_dirtyRects.size() > kMaxDirtyRects) {
+		for (uint i = 1; i < _dirtyRects.size(); ++i)
+			_dirtyRects[0].extend(_dirtyRects[i]);
+		_dirtyRects.resize(1);
+	}
 }
 
 void RenderObjectManager::attatchTimedRenderObject(RenderObjectPtr<TimedRenderObject> renderObjectPtr) {
@@ -140,6 +187,8 @@ bool RenderObjectManager::unpersist(InputPersistenceBlock &reader) {
 	// Alle BS_AnimationTemplates wieder herstellen.
 	result &= AnimationTemplateRegistry::instance().unpersist(reader);
 
+	invalidate();
+
 	return result;
 }
 
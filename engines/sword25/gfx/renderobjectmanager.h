@@ -106,6 +106,18 @@ public:
 	*/
 	void detatchTimedRenderObject(RenderObjectPtr<TimedRenderObject> pRenderObject);
 
+	/**
+	    @brief Marks a screen area as changed, so that it is redrawn by the next call of render().
+	    @param rect the area in screen coordinates
+	*/
+	void addDirtyRect(const Common::Rect &rect);
+	/**
+	    @brief Marks the whole screen as changed.
+	*/
+	void invalidate() {
+		addDirtyRect(_screenRect);
+	}
+
 	virtual bool persist(OutputPersistenceBlock &writer);
 	virtual bool unpersist(InputPersistenceBlock &reader);
 
@@ -114,6 +126,11 @@ private:
 	typedef Common::Array<RenderObjectPtr<TimedRenderObject> > RenderObjectList;
 	RenderObjectList _timedRenderObjects;
 
+	// The screen areas that changed since the last frame. They never overlap,
+	// so that no part of the screen is drawn twice in one frame.
+	Common::Array<Common::Rect> _dirtyRects;
+	Common::Rect _screenRect;
+
 	// RenderObject-Tree Variablen
 	// ---------------------------
 	// Der Baum legt die hierachische Ordnung der BS_RenderObjects fest.
@@ -162,6 +162,8 @@ bool Text::doRender() {
 		// Feststellen, ob berhaupt Buchstaben der aktuellen Zeile vom Update betroffen sind.
 		Common::Rect checkRect = (*iter).bbox;
 		checkRect.translate(_absoluteX, _absoluteY);
+		if (!checkRect.intersects(gfxPtr->getClipRect()))
+			continue;
 
 		// Jeden Buchstaben einzeln Rendern.
 		int curX = _absoluteX + (*iter).bbox.left;
@@ -37,7 +37,7 @@ const uint INITIAL_BUFFER_SIZE = 1024 * 64;
 
 namespace Sword25 {
 
-OutputPersistenceBlock::OutputPersistenceBlock() {
+OutputPersistenceBlock::OutputPersistenceBlock() : _byteArraySizePos(0) {
 	_data.reserve(INITIAL_BUFFER_SIZE);
 }
 
@@ -85,6 +85,22 @@ void OutputPersistenceBlock::writeByteArray(Common::Array<byte> &value) {
 	rawWrite(&value[0], value.size());
 }
 
+void OutputPersistenceBlock::beginByteArray() {
+	writeMarker(BLOCK_MARKER);
+
+	// The size is filled in by endByteArray()
+	write((uint)0);
+	_byteArraySizePos = _data.size() - sizeof(uint);
+}
+
+void OutputPersistenceBlock::appendByteArray(const void *dataPtr, size_t size) {
+	rawWrite(dataPtr, size);
+}
+
+void OutputPersistenceBlock::endByteArray() {
+	WRITE_LE_UINT32(&_data[_byteArraySizePos], _data.size() - _byteArraySizePos - sizeof(uint));
+}
+
 void OutputPersistenceBlock::writeMarker(byte marker) {
 	_data.push_back(marker);
 }
@@ -92,6 +108,13 @@ void OutputPersistenceBlock::writeMarker(byte marker) {
 void OutputPersistenceBlock::rawWrite(const void *dataPtr, size_t size) {
 	if (size > 0) {
 		uint oldSize = _data.size();
+
+		// Grow the buffer geometrically, so that many small writes stay cheap
+		uint capacity = INITIAL_BUFFER_SIZE;
+		while (capacity < oldSize + size)
+			capacity *= 2;
+		_data.reserve(capacity);
+
 		_data.resize(oldSize + size);
 		memcpy(&_data[oldSize], dataPtr, size);
 	}
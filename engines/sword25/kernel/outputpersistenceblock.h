@@ -48,6 +48,15 @@ public:
 	void writeString(const Common::String &string);
 	void writeByteArray(Common::Array<byte> &value);
 
+	/**
+	 * Writes a byte array whose contents are passed in pieces to appendByteArray(),
+	 * so that callers producing data incrementally need not collect it in a
+	 * buffer of their own first. Must be finished with endByteArray().
+	 */
+	void beginByteArray();
+	void appendByteArray(const void *dataPtr, size_t size);
+	void endByteArray();
+
 	const void *getData() const {
 		return &_data[0];
 	}
@@ -60,6 +69,7 @@ private:
 	void rawWrite(const void *dataPtr, size_t size);
 
 	Common::Array<byte> _data;
+	uint _byteArraySizePos;
 };
 
 } // End of namespace Sword25
@@ -122,22 +122,31 @@ struct SavegameInformation {
 
 struct PersistenceService::Impl {
 	SavegameInformation _savegameInformations[SLOT_COUNT];
+	bool _savegameInformationRead[SLOT_COUNT];
 
 	Impl() {
 		reloadSlots();
 	}
 
 	void reloadSlots() {
-		// Iterate through all the saved games, and read their thumbnails.
+		// The saved games are only opened once their slot is asked about,
+		// rather than opening every one of them up front.
 		for (uint i = 0; i < SLOT_COUNT; ++i) {
-			readSlotSavegameInformation(i);
+			_savegameInformationRead[i] = false;
 		}
 	}
 
+	SavegameInformation &getSlotSavegameInformation(uint slotID) {
+		if (!_savegameInformationRead[slotID])
+			readSlotSavegameInformation(slotID);
+		return _savegameInformations[slotID];
+	}
+
 	void readSlotSavegameInformation(uint slotID) {
 		// Get the information corresponding to the requested save slot.
 		SavegameInformation &curSavegameInfo = _savegameInformations[slotID];
 		curSavegameInfo.clear();
+		_savegameInformationRead[slotID] = true;
 
 		// Generate the save slot file name.
 		Common::String filename = generateSavegameFilename(slotID);
@@ -227,20 +236,20 @@ bool checkslotID(uint slotID) {
 bool PersistenceService::isSlotOccupied(uint slotID) {
 	if (!checkslotID(slotID))
 		return false;
-	return _impl->_savegameInformations[slotID].isOccupied;
+	return _impl->getSlotSavegameInformation(slotID).isOccupied;
 }
 
 bool PersistenceService::isSavegameCompatible(uint slotID) {
 	if (!checkslotID(slotID))
 		return false;
-	return _impl->_savegameInformations[slotID].isCompatible;
+	return _impl->getSlotSavegameInformation(slotID).isCompatible;
 }
 
 Common::String &PersistenceService::getSavegameDescription(uint slotID) {
 	static Common::String emptyString;
 	if (!checkslotID(slotID))
 		return emptyString;
-	return _impl->_savegameInformations[slotID].description;
+	return _impl->getSlotSavegameInformation(slotID).description;
 }
 
 Common::String &PersistenceService::getSavegameFilename(uint slotID) {
@@ -254,7 +263,7 @@ Common::String &PersistenceService::getSavegameFilename(uint slotID) {
 int PersistenceService::getSavegameVersion(uint slotID) {
 	if (!checkslotID(slotID))
 		return -1;
-	return _impl->_savegameInformations[slotID].version;
+	return _impl->getSlotSavegameInformation(slotID).version;
 }
 
 bool PersistenceService::saveGame(uint slotID, const Common::String &screenshotFilename) {
@@ -355,7 +364,7 @@ bool PersistenceService::loadGame(uint slotID) {
 		return false;
 	}
 
-	SavegameInformation &curSavegameInfo = _impl->_savegameInformations[slotID];
+	SavegameInformation &curSavegameInfo = _impl->getSlotSavegameInformation(slotID);
 
 	// berprfen, ob der Slot belegt ist.
 	if (!curSavegameInfo.isOccupied) {
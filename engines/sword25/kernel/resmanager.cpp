@@ -35,17 +35,25 @@
 #include "sword25/kernel/resservice.h"
 #include "sword25/package/packagemanager.h"
 
+#include "common/system.h"
+
 namespace Sword25 {
 
-// Sets the amount of resources that are simultaneously loaded.
-// This needs to be a relatively high number, as all the animation
-// frames in each scene are loaded as separate resources.
-// Also, George's walk states are all loaded here (150 files)
-#define SWORD25_RESOURCECACHE_MIN 400
-// The maximum number of loaded resources. If more than these resources
-// are loaded, the resource manager will start purging resources till it
-// hits the minimum limit above
-#define SWORD25_RESOURCECACHE_MAX 500
+// The default amount of memory that loaded resources may occupy. This is
+// the value that the game scripts set as well. It needs to be relatively
+// high, as all the animation frames in each scene are loaded as separate
+// resources. Also, George's walk states are all loaded here (150 files)
+#define SWORD25_RESOURCECACHE_MAX_MEMORY 256000000
+// Once the limit is hit, unused resources are purged until only this
+// percentage of the limit is used, so that the next resource does not
+// trigger another purge right away
+#define SWORD25_RESOURCECACHE_MIN_PERCENT 90
+
+ResourceManager::ResourceManager(Kernel *pKernel) :
+	_kernelPtr(pKernel),
+	_usedMemory(0),
+	_maxMemoryUsage(SWORD25_RESOURCECACHE_MAX_MEMORY) {
+}
 
 ResourceManager::~ResourceManager() {
 	// Clear all unlocked resources
@@ -87,9 +95,11 @@ bool ResourceManager::registerResourceService(ResourceService *pService) {
  */
 void ResourceManager::deleteResourcesIfNecessary() {
 	// If enough memory is available, or no resources are loaded, then the function can immediately end
-	if (_resources.size() < SWORD25_RESOURCECACHE_MAX)
+	if (_usedMemory < _maxMemoryUsage || _resources.empty())
 		return;
 
+	const uint minMemoryUsage = _maxMemoryUsage / 100 * SWORD25_RESOURCECACHE_MIN_PERCENT;
+
 	// Keep deleting resources until the memory usage of the process falls below the set maximum limit.
 	// The list is processed backwards in order to first release those resources that have been
 	// not been accessed for the longest
@@ -100,14 +110,14 @@ void ResourceManager::deleteResourcesIfNecessary() {
 		// The resource may be released only if it isn't locked
 		if ((*iter)->getLockCount() == 0)
 			iter = deleteResource(*iter);
-	} while (iter != _resources.begin() && _resources.size() >= SWORD25_RESOURCECACHE_MIN);
+	} while (iter != _resources.begin() && _usedMemory >= minMemoryUsage);
 
-	// Are we still above the minimum? If yes, then start releasing locked resources
+	// Are we still above the maximum? If yes, then start releasing locked resources
 	// FIXME: This code shouldn't be needed at all, but it seems like there is a bug
 	// in the resource lock code, and resources are not unlocked when changing rooms.
 	// Only image/animation resources are unlocked forcibly, thus this shouldn't have
 	// any impact on the game itself.
-	if (_resources.size() <= SWORD25_RESOURCECACHE_MIN)
+	if (_usedMemory <= _maxMemoryUsage || _resources.empty())
 		return;
 
 	iter = _resources.end();
@@ -126,7 +136,7 @@ void ResourceManager::deleteResourcesIfNecessary() {
 
 			iter = deleteResource(*iter);
 		}
-	} while (iter != _resources.begin() && _resources.size() >= SWORD25_RESOURCECACHE_MIN);
+	} while (iter != _resources.begin() && _usedMemory >= minMemoryUsage);
 }
 
 /**
@@ -220,6 +230,42 @@ bool ResourceManager::precacheResource(const Common::String &fileName, bool forc
 
 #endif
 
+/**
+ * Queues a resource to be loaded into the cache by precacheQueued()
+ * @param FileName      The filename of the resource to be cached
+ */
+void ResourceManager::queuePrecache(const Common::String &fileName) {
+	// Resolve the name now, as the current directory may change until the resource is loaded
+	Common::String uniqueFileName = getUniqueFileName(fileName);
+	if (!uniqueFileName.empty() && !getResource(uniqueFileName))
+		_precacheQueue.push_back(uniqueFileName);
+}
+
+/**
+ * Loads queued resources into the cache, until the given time has passed
+ * @param MaxTime       How many milliseconds may be spent loading
+ */
+void ResourceManager::precacheQueued(uint maxTime) {
+	uint32 startTime = g_system->getMillis();
+	while (!_precacheQueue.empty() && g_system->getMillis() - startTime < maxTime) {
+		Common::String uniqueFileName = _precacheQueue.front();
+		_precacheQueue.pop_front();
+
+		// The resource may have been requested in the meantime
+		if (getResource(uniqueFileName))
+			continue;
+
+		// This isn't fatal - e.g. it can happen when loading saved games
+		if (!_kernelPtr->getPackage()->fileExists(uniqueFileName)) {
+			debugC(kDebugResource, "Could not precache \"%s\",", uniqueFileName.c_str());
+			continue;
+		}
+
+		// The resource stays in the cache unlocked, until it is requested or purged
+		loadResource(uniqueFileName);
+	}
+}
+
 /**
  * Moves a resource to the top of the resource list
  * @param pResource     The resource
@@ -257,6 +303,10 @@ Resource *ResourceManager::loadResource(const Common::String &fileName) {
 			_resources.push_front(pResource);
 			pResource->_iterator = _resources.begin();
 
+			// Charge the resource to the cache
+			pResource->_dataSize = pResource->getDataSize();
+			_usedMemory += pResource->_dataSize;
+
 			// Also store the resource in the hash table for quick lookup
 			_resourceHashMap[pResource->getFileName()] = pResource;
 
@@ -299,6 +349,8 @@ Common::List<Resource *>::iterator ResourceManager::deleteResource(Resource *pRe
 	// Delete the resource from the resource list
 	Common::List<Resource *>::iterator result = _resources.erase(pResource->_iterator);
 
+	_usedMemory -= pResource->_dataSize;
+
 	// Delete the resource
 	delete pResource;
 
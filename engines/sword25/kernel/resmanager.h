@@ -66,6 +66,38 @@ public:
 	bool precacheResource(const Common::String &fileName, bool forceReload = false);
 #endif
 
+	/**
+	 * Queues a resource to be loaded into the cache by precacheQueued(), so that loading
+	 * it does not hold up the caller
+	 * @param FileName      The filename of the resource to be cached
+	 */
+	void queuePrecache(const Common::String &fileName);
+
+	/**
+	 * Loads queued resources into the cache
+	 * @param MaxTime       How many milliseconds may be spent loading
+	 */
+	void precacheQueued(uint maxTime);
+
+	/**
+	 * Sets how many bytes the cached resources may occupy before unused ones are released
+	 */
+	void setMaxMemoryUsage(uint maxMemoryUsage) {
+		_maxMemoryUsage = maxMemoryUsage;
+		deleteResourcesIfNecessary();
+	}
+
+	uint getMaxMemoryUsage() const {
+		return _maxMemoryUsage;
+	}
+
+	/**
+	 * Returns how many bytes the loaded resources occupy
+	 */
+	uint getUsedMemory() const {
+		return _usedMemory;
+	}
+
 	/**
 	 * Registers a RegisterResourceService. This method is the constructor of
 	 * BS_ResourceService, and thus helps all resource services in the ResourceManager list
@@ -93,9 +125,7 @@ private:
 	 * Creates a new resource manager
 	 * Only the BS_Kernel class can generate copies this class. Thus, the constructor is private
 	 */
-	ResourceManager(Kernel *pKernel) :
-		_kernelPtr(pKernel)
-	{}
+	ResourceManager(Kernel *pKernel);
 	virtual ~ResourceManager();
 
 	/**
@@ -139,6 +169,9 @@ private:
 	Common::List<Resource *> _resources;
 	typedef Common::HashMap<Common::String, Resource *> ResMap;
 	ResMap _resourceHashMap;
+	uint _usedMemory;
+	uint _maxMemoryUsage;
+	Common::List<Common::String> _precacheQueue;
 };
 
 } // End of namespace Sword25
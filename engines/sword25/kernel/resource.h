@@ -92,6 +92,13 @@ public:
 		return _type;
 	}
 
+	/**
+	 * Returns roughly how many bytes of memory the resource occupies
+	 */
+	virtual uint getDataSize() const {
+		return 0;
+	}
+
 protected:
 	virtual ~Resource() {}
 
@@ -99,6 +106,7 @@ private:
 	Common::String _fileName;          ///< The absolute filename
 	uint _refCount;          ///< The number of locks
 	uint _type;              ///< The type of the resource
+	uint _dataSize;          ///< The size that was charged to the cache when the resource was loaded
 	Common::List<Resource *>::iterator _iterator;        ///< Points to the resource position in the LRU list
 };
 
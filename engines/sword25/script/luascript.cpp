@@ -387,11 +387,8 @@ bool pushPermanentsTable(lua_State *L, PERMANENT_TABLE_TYPE tableType) {
 
 namespace {
 int chunkwriter(lua_State *L, const void *p, size_t sz, void *ud) {
-	Common::Array<byte> & chunkData = *reinterpret_cast<Common::Array<byte> * >(ud);
-	const byte *buffer = reinterpret_cast<const byte *>(p);
-
-	while (sz--)
-		chunkData.push_back(*buffer++);
+	OutputPersistenceBlock &writer = *reinterpret_cast<OutputPersistenceBlock *>(ud);
+	writer.appendByteArray(p, sz);
 
 	return 1;
 }
@@ -409,12 +406,10 @@ bool LuaScriptEngine::persist(OutputPersistenceBlock &writer) {
 	pushPermanentsTable(_state, PTT_PERSIST);
 	lua_getglobal(_state, "_G");
 
-	// Lua persists and stores the data in a Common::Array
-	Common::Array<byte> chunkData;
-	pluto_persist(_state, chunkwriter, &chunkData);
-
-	// Persistenzdaten in den Writer schreiben.
-	writer.writeByteArray(chunkData);
+	// Lua persists its data straight into the writer
+	writer.beginByteArray();
+	pluto_persist(_state, chunkwriter, &writer);
+	writer.endByteArray();
 
 	// Die beiden Tabellen vom Stack nehmen.
 	lua_pop(_state, 2);
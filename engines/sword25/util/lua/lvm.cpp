@@ -369,6 +369,30 @@ static void Arith (lua_State *L, StkId ra, const TValue *rb,
       }
 
 
+/*
+** fast paths for string keys already present in a table, which covers
+** most global and field accesses; anything else (missing keys, metamethods)
+** goes through luaV_gettable/luaV_settable
+*/
+#define fastgetstr(L,h,key,val) { \
+        const TValue *res = luaH_getstr(h, rawtsvalue(key)); \
+        if (!ttisnil(res)) { \
+          setobj2s(L, val, res); \
+          continue; \
+        } \
+      }
+
+#define fastsetstr(L,h,key,val) { \
+        TValue *oldval = const_cast<TValue *>(luaH_getstr(h, rawtsvalue(key))); \
+        if (!ttisnil(oldval)) { \
+          (h)->flags = 0; \
+          setobj2t(L, oldval, val); \
+          luaC_barriert(L, h, val); \
+          continue; \
+        } \
+      }
+
+
 
 void luaV_execute (lua_State *L, int nexeccalls) {
   LClosure *cl;
@@ -428,19 +452,25 @@ void luaV_execute (lua_State *L, int nexeccalls) {
       case OP_GETGLOBAL: {
         TValue g;
         TValue *rb = KBx(i);
-        sethvalue(L, &g, cl->env);
         lua_assert(ttisstring(rb));
+        fastgetstr(L, cl->env, rb, ra);
+        sethvalue(L, &g, cl->env);
         Protect(luaV_gettable(L, &g, rb, ra));
         continue;
       }
       case OP_GETTABLE: {
-        Protect(luaV_gettable(L, RB(i), RKC(i), ra));
+        TValue *rb = RB(i);
+        TValue *rc = RKC(i);
+        if (ttistable(rb) && ttisstring(rc))
+          fastgetstr(L, hvalue(rb), rc, ra);
+        Protect(luaV_gettable(L, rb, rc, ra));
         continue;
       }
       case OP_SETGLOBAL: {
         TValue g;
-        sethvalue(L, &g, cl->env);
         lua_assert(ttisstring(KBx(i)));
+        fastsetstr(L, cl->env, KBx(i), ra);
+        sethvalue(L, &g, cl->env);
         Protect(luaV_settable(L, &g, KBx(i), ra));
         continue;
       }
@@ -451,7 +481,11 @@ void luaV_execute (lua_State *L, int nexeccalls) {
         continue;
       }
       case OP_SETTABLE: {
-        Protect(luaV_settable(L, ra, RKB(i), RKC(i)));
+        TValue *rb = RKB(i);
+        TValue *rc = RKC(i);
+        if (ttistable(ra) && ttisstring(rb))
+          fastsetstr(L, hvalue(ra), rb, rc);
+        Protect(luaV_settable(L, ra, rb, rc));
         continue;
       }
       case OP_NEWTABLE: {
@@ -463,8 +497,11 @@ void luaV_execute (lua_State *L, int nexeccalls) {
       }
       case OP_SELF: {
         StkId rb = RB(i);
+        TValue *rc = RKC(i);
         setobjs2s(L, ra+1, rb);
-        Protect(luaV_gettable(L, rb, RKC(i), ra));
+        if (ttistable(rb) && ttisstring(rc))
+          fastgetstr(L, hvalue(rb), rc, ra);
+        Protect(luaV_gettable(L, rb, rc, ra));
         continue;
       }
       case OP_ADD: {
@@ -44,6 +44,29 @@ extern uint8 g_transPalette[MAX_COLORS];
 
 //----------------- SUPPORT FUNCTIONS ---------------------
 
+/**
+ * Copies the non-zero pixels of one row of a 4x4 character block. Complete
+ * rows are merged a word at a time, using a mask built from the non-zero bytes.
+ */
+static inline void WrtNonZeroRow(const uint8 *srcP, uint8 *destP, int left, int right) {
+	if (left == 0 && right == 3) {
+		uint32 pixels = READ_UINT32(srcP);
+		if (pixels == 0)
+			return;
+
+		// Set the top bit of each non-zero byte, and then spread it across the byte
+		uint32 mask = (((pixels & 0x7f7f7f7f) + 0x7f7f7f7f) | pixels) & 0x80808080;
+		mask = (mask >> 7) * 0xff;
+
+		WRITE_UINT32(destP, (READ_UINT32(destP) & ~mask) | (pixels & mask));
+	} else {
+		for (int xp = left; xp <= right; ++xp) {
+			if (srcP[xp])
+				destP[xp - left] = srcP[xp];
+		}
+	}
+}
+
 /**
  * PSX Block list unwinder.
  * Chunk type 0x0003 (CHUNK_CHARPTR) in PSX version of DW 1 & 2 is compressed (original code
@@ -289,10 +312,7 @@ static void PsxDrawTiles(DRAWOBJECT *pObj, uint8 *srcP, uint8 *destP, bool apply
 					if (!transparency)
 						Common::copy(p + boxBounds.left, p + boxBounds.right + 1, tempDest + (SCREEN_WIDTH * (yp - boxBounds.top)));
 					else
-						for (int xp = boxBounds.left; xp <= boxBounds.right; ++xp) {
-							if (*(p + xp))
-								*(tempDest + SCREEN_WIDTH * (yp - boxBounds.top) + (xp - boxBounds.left)) = *(p + xp);
-						}
+						WrtNonZeroRow(p, tempDest + SCREEN_WIDTH * (yp - boxBounds.top), boxBounds.left, boxBounds.right);
 				} else {
 					for (int xp = boxBounds.left; xp <= boxBounds.right; ++xp) {
 						// Extract pixel value from byte
@@ -401,16 +421,10 @@ static void WrtNonZero(DRAWOBJECT *pObj, uint8 *srcP, uint8 *destP, bool applyCl
 					// Use the index along with the object's translation offset
 					const uint8 *p = (uint8 *)pObj->charBase + ((pObj->transOffset + indexVal) << 4);
 
-					// Loop through each pixel - only draw a pixel if it's non-zero
+					// Loop through each row - only draw pixels that are non-zero
 					p += boxBounds.top * sizeof(uint32);
-					for (int yp = boxBounds.top; yp <= boxBounds.bottom; ++yp) {
-						p += boxBounds.left;
-						for (int xp = boxBounds.left; xp <= boxBounds.right; ++xp, ++p) {
-							if (*p)
-								*(tempDest + SCREEN_WIDTH * (yp - boxBounds.top) + (xp - boxBounds.left)) = *p;
-						}
-						p += 3 - boxBounds.right;
-					}
+					for (int yp = boxBounds.top; yp <= boxBounds.bottom; ++yp, p += sizeof(uint32))
+						WrtNonZeroRow(p, tempDest + SCREEN_WIDTH * (yp - boxBounds.top), boxBounds.left, boxBounds.right);
 				}
 			}
 
@@ -499,15 +513,20 @@ static void t2WrtNonZero(DRAWOBJECT *pObj, uint8 *srcP, uint8 *destP, bool apply
 				int runLength = numBytes - clipAmount;
 				x += numBytes - runLength;
 
-				for (int xp = 0; xp < runLength; ++xp) {
-					if ((yClip > 0) || (x >= (pObj->width - rightClip)))
-						++srcP;
-					else if (horizFlipped)
-						*tempP-- = pObj->constant + *srcP++;
-					else
-						*tempP++ = pObj->constant + *srcP++;
-					++x;
+				// Only the part of the run left of the right clipping is drawn
+				int drawLength = (yClip > 0) ? 0 : CLIP(pObj->width - rightClip - x, 0, runLength);
+				if (horizFlipped) {
+					for (int xp = 0; xp < drawLength; ++xp)
+						tempP[-xp] = pObj->constant + srcP[xp];
+					tempP -= drawLength;
+				} else {
+					for (int xp = 0; xp < drawLength; ++xp)
+						tempP[xp] = pObj->constant + srcP[xp];
+					tempP += drawLength;
 				}
+
+				srcP += runLength;
+				x += runLength;
 			}
 		}
 		assert(x == pObj->width);
@@ -690,13 +709,16 @@ static void PackedWrtNonZero(DRAWOBJECT *pObj, uint8 *srcP, uint8 *destP,
 			numBytes -= v;
 			x += v;
 
-			while (numBytes-- > 0) {
-				if ((topClip == 0) && (x < (pObj->width - rightClip))) {
-					*tempP = color;
-					if (horizFlipped) --tempP; else ++tempP;
-				}
-				++x;
+			// Only the part of the run left of the right clipping is drawn
+			int drawLength = (topClip > 0) ? 0 : CLIP(pObj->width - rightClip - x, 0, numBytes);
+			if (horizFlipped) {
+				Common::fill(tempP - drawLength + 1, tempP + 1, (uint8)color);
+				tempP -= drawLength;
+			} else {
+				Common::fill(tempP, tempP + drawLength, (uint8)color);
+				tempP += drawLength;
 			}
+			x += numBytes;
 		}
 		assert(x <= pObj->width);
 
@@ -25,6 +25,8 @@
 #include "tinsel/timers.h"	// For DwGetCurrentTime
 #include "tinsel/tinsel.h"
 
+#include "common/config-manager.h"
+
 namespace Tinsel {
 
 
@@ -45,6 +47,9 @@ struct MEM_NODE {
 	long size;		// size of the memory object
 	uint32 lruTime;		// time when memory object was last accessed
 	int flags;		// allocation attributes
+	MEM_NODE *pLruNext;	// link to the next more recently used discardable node
+	MEM_NODE *pLruPrev;	// link to the previous less recently used discardable node
+	bool wasDiscarded;	// memory object has been discarded at least once
 };
 
 
@@ -52,6 +57,8 @@ struct MEM_NODE {
 // Currently this is set at 5MB for the DW1 demo and DW1 and 10MB for DW2
 // This could probably be reduced somewhat
 // If the memory is not enough, the engine throws an "Out of memory" error in handle.cpp inside LockMem()
+// The "tinsel_heap_size" config key (in MB) can be used to raise it, so that fewer
+// resources have to be discarded and reloaded from disk
 static const uint32 MemoryPoolSize[3] = {5 * 1024 * 1024, 5 * 1024 * 1024, 10 * 1024 * 1024};
 
 // FIXME: Avoid non-const global vars
@@ -69,6 +76,13 @@ MEM_NODE g_s_fixedMnodesList[5];
 // the mnode heap sentinel
 static MEM_NODE g_heapSentinel;
 
+// the sentinel of the list of discardable mnodes, least recently used first
+static MEM_NODE g_lruSentinel;
+
+// number of memory objects discarded, and of discarded objects loaded again
+static uint32 g_numDiscards;
+static uint32 g_numReloads;
+
 //
 static MEM_NODE *AllocMemNode();
 
@@ -94,11 +108,36 @@ static void MemoryStats() {
 		}
 	}
 
-	debug("%d nodes used, %d alloced, %d locked; %d bytes locked, %d used",
-			usedNodes, allocedNodes, lockedNodes, lockedSize, totalSize);
+	debug("%d nodes used, %d alloced, %d locked; %d bytes locked, %d used; %u discards, %u reloads",
+			usedNodes, allocedNodes, lockedNodes, lockedSize, totalSize, g_numDiscards, g_numReloads);
 }
 #endif
 
+/**
+ * Adds a discardable node to the LRU list, keeping it ordered by LRU time.
+ * Nodes are normally touched in time order, so this rarely has to look
+ * further back than the end of the list.
+ */
+static void LruInsert(MEM_NODE *pMemNode) {
+	MEM_NODE *pPrev = g_lruSentinel.pLruPrev;
+	while (pPrev != &g_lruSentinel && pPrev->lruTime > pMemNode->lruTime)
+		pPrev = pPrev->pLruPrev;
+
+	pMemNode->pLruPrev = pPrev;
+	pMemNode->pLruNext = pPrev->pLruNext;
+	pPrev->pLruNext->pLruPrev = pMemNode;
+	pPrev->pLruNext = pMemNode;
+}
+
+/**
+ * Removes a node from the LRU list.
+ */
+static void LruRemove(MEM_NODE *pMemNode) {
+	pMemNode->pLruPrev->pLruNext = pMemNode->pLruNext;
+	pMemNode->pLruNext->pLruPrev = pMemNode->pLruPrev;
+	pMemNode->pLruNext = pMemNode->pLruPrev = NULL;
+}
+
 /**
  * Initializes the memory manager.
  */
@@ -125,10 +164,23 @@ void MemoryInit() {
 	// flag sentinel as locked
 	g_heapSentinel.flags = DWM_LOCKED | DWM_SENTINEL;
 
+	// the LRU list starts out empty
+	g_lruSentinel.pLruPrev = &g_lruSentinel;
+	g_lruSentinel.pLruNext = &g_lruSentinel;
+	g_lruSentinel.flags = DWM_LOCKED | DWM_SENTINEL;
+
+	g_numDiscards = 0;
+	g_numReloads = 0;
+
 	// store the current heap size in the sentinel
 	uint32 size = MemoryPoolSize[0];
 	if (TinselVersion == TINSEL_V1) size = MemoryPoolSize[1];
 	else if (TinselVersion == TINSEL_V2) size = MemoryPoolSize[2];
+	if (ConfMan.hasKey("tinsel_heap_size")) {
+		// Size in MB, limited to a sane range before it is converted
+		uint32 configSize = (uint32)CLIP(ConfMan.getInt("tinsel_heap_size"), 0, 1024);
+		size = MAX<uint32>(size, configSize * 1024 * 1024);
+	}
 	g_heapSentinel.size = size;
 }
 
@@ -194,26 +246,13 @@ void FreeMemNode(MEM_NODE *pMemNode) {
  * @return true if any blocks were discarded, false otherwise
  */
 static bool HeapCompact(long size) {
-	const MEM_NODE *pHeap = &g_heapSentinel;
-	MEM_NODE *pCur, *pOldest;
-	uint32 oldest;		// time of the oldest discardable block
+	const uint32 now = DwGetCurrentTime();
 
 	while (g_heapSentinel.size < size) {
+		// the oldest discardable block heads the LRU list
+		MEM_NODE *pOldest = g_lruSentinel.pLruNext;
 
-		// find the oldest discardable block
-		oldest = DwGetCurrentTime();
-		pOldest = NULL;
-		for (pCur = pHeap->pNext; pCur != pHeap; pCur = pCur->pNext) {
-			if (pCur->flags == DWM_USED) {
-				// found a non-discarded discardable block
-				if (pCur->lruTime < oldest) {
-					oldest = pCur->lruTime;
-					pOldest = pCur;
-				}
-			}
-		}
-
-		if (pOldest)
+		if (pOldest != &g_lruSentinel && pOldest->lruTime < now)
 			// discard the oldest block
 			MemoryDiscard(pOldest);
 		else
@@ -265,6 +304,7 @@ static MEM_NODE *MemoryAlloc(long size) {
 	pNode->flags = DWM_USED;
 	pNode->lruTime = DwGetCurrentTime() + 1;
 	pNode->size = size;
+	LruInsert(pNode);
 
 	// set mnode at the end of the list
 	pNode->pPrev = pHeap->pPrev;
@@ -353,6 +393,10 @@ void MemoryDiscard(MEM_NODE *pMemNode) {
 		free(pMemNode->pBaseAddr);
 		g_heapSentinel.size += pMemNode->size;
 
+		LruRemove(pMemNode);
+		pMemNode->wasDiscarded = true;
+		g_numDiscards++;
+
 #ifdef DEBUG
 		MemoryStats();
 #endif
@@ -377,8 +421,10 @@ void *MemoryLock(MEM_NODE *pMemNode) {
 	if ((pMemNode->flags & DWM_DISCARDED) || pMemNode->size == 0)
 		return NULL;
 
-	// set the lock flag
+	// set the lock flag, which makes the object non-discardable
 	pMemNode->flags |= DWM_LOCKED;
+	if (pMemNode->pLruNext)
+		LruRemove(pMemNode);
 
 #ifdef DEBUG
 	MemoryStats();
@@ -405,6 +451,10 @@ void MemoryUnlock(MEM_NODE *pMemNode) {
 
 	// update the LRU time
 	pMemNode->lruTime = DwGetCurrentTime();
+
+	// the object can be discarded again, unless it is a fixed block
+	if (pMemNode >= g_mnodeList && pMemNode <= g_mnodeList + NUM_MNODES - 1)
+		LruInsert(pMemNode);
 }
 
 /**
@@ -433,6 +483,10 @@ void MemoryReAlloc(MEM_NODE *pMemNode, long size) {
 		pMemNode->pNext->pPrev = pMemNode->pPrev;
 		pMemNode->pPrev->pNext = pMemNode->pNext;
 
+		const bool wasDiscarded = pMemNode->wasDiscarded;
+		if (wasDiscarded)
+			g_numReloads++;
+
 		// allocate a new node
 		pNew = MemoryAlloc(size);
 
@@ -445,6 +499,9 @@ void MemoryReAlloc(MEM_NODE *pMemNode, long size) {
 		// relink the mnode into the list
 		pMemNode->pPrev->pNext = pMemNode;
 		pMemNode->pNext->pPrev = pMemNode;
+		pMemNode->pLruPrev->pLruNext = pMemNode;
+		pMemNode->pLruNext->pLruPrev = pMemNode;
+		pMemNode->wasDiscarded = wasDiscarded;
 
 		// free the new node
 		FreeMemNode(pNew);
@@ -460,6 +517,12 @@ void MemoryReAlloc(MEM_NODE *pMemNode, long size) {
 void MemoryTouch(MEM_NODE *pMemNode) {
 	// update the LRU time
 	pMemNode->lruTime = DwGetCurrentTime();
+
+	// and move the object to the most recently used end of the LRU list
+	if (pMemNode->pLruNext) {
+		LruRemove(pMemNode);
+		LruInsert(pMemNode);
+	}
 }
 
 uint8 *MemoryDeref(MEM_NODE *pMemNode) {
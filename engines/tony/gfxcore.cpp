@@ -252,6 +252,7 @@ RMGfxTargetBuffer::RMGfxTargetBuffer() {
 	_otlist = NULL;
 	_otSize = 0;
 	_trackDirtyRects = false;
+	_frameCount = 0;
 }
 
 RMGfxTargetBuffer::~RMGfxTargetBuffer() {
@@ -382,6 +383,7 @@ void RMGfxTargetBuffer::clearDirtyRects() {
 		_previousDirtyRects.push_back(*i);
 
 	_currentDirtyRects.clear();
+	_frameCount++;
 }
 
 /**
@@ -477,6 +479,10 @@ bool RMGfxTargetBuffer::getTrackDirtyRects() const {
 	return _trackDirtyRects;
 }
 
+uint32 RMGfxTargetBuffer::getFrameCount() const {
+	return _frameCount;
+}
+
 /****************************************************************************\
 *               RMGfxSourceBufferPal Methods
 \****************************************************************************/
@@ -676,20 +682,9 @@ RMGfxSourceBuffer8AB::~RMGfxSourceBuffer8AB() {
 }
 
 int RMGfxSourceBuffer8AB::calcTrasp(int fore, int back) {
-	int r = (GETRED(fore) >> 2) + (GETRED(back) >> 1);
-	int g = (GETGREEN(fore) >> 2) + (GETGREEN(back) >> 1);
-	int b = (GETBLUE(fore) >> 2) + (GETBLUE(back) >> 1);
-
-	if (r > 0x1F)
-		r = 0x1F;
-
-	if (g > 0x1F)
-		g = 0x1F;
-
-	if (b > 0x1F)
-		b = 0x1F;
-
-	return (r << 10) | (g << 5) | b;
+	// A quarter of the foreground plus half the background, done on all three
+	// channels at once. The sum can't exceed 7 + 15, so no channel overflows
+	return ((fore >> 2) & 0x1CE7) + ((back >> 1) & 0x3DEF);
 }
 
 void RMGfxSourceBuffer8AB::draw(CORO_PARAM, RMGfxTargetBuffer &bigBuf, RMGfxPrimitive *prim) {
@@ -759,6 +754,39 @@ void RMGfxSourceBuffer8AB::draw(CORO_PARAM, RMGfxTargetBuffer &bigBuf, RMGfxPrim
 
 byte RMGfxSourceBuffer8RLE::_megaRLEBuf[512 * 1024];
 
+/**
+ * Run kernels shared by the RLE decoders. They work on whole 5-5-5 pixels
+ * using channel masks instead of unpacking each channel, which keeps the
+ * loops simple enough for the compiler to vectorize.
+ */
+static inline void rleAlphaRun(uint16 *dst, int n, uint16 alpha) {
+	// A quarter of the background plus the pre-halved blend color
+	for (int i = 0; i < n; i++)
+		dst[i] = ((dst[i] >> 2) & 0x1CE7) + alpha;
+}
+
+static inline void rleHalfBlendRun(uint16 *dst, const byte *src, int n, const uint16 *pal) {
+	for (int i = 0; i < n; i++)
+		dst[i] = ((dst[i] >> 1) & 0x3DEF) + ((pal[src[i]] >> 1) & 0x3DEF);
+}
+
+static inline void rleCopyRun(uint16 *dst, const byte *src, int n, const uint16 *pal) {
+	int i = 0;
+	for (; i + 4 <= n; i += 4) {
+		dst[i + 0] = pal[src[i + 0]];
+		dst[i + 1] = pal[src[i + 1]];
+		dst[i + 2] = pal[src[i + 2]];
+		dst[i + 3] = pal[src[i + 3]];
+	}
+	for (; i < n; i++)
+		dst[i] = pal[src[i]];
+}
+
+static inline void rleCopyRunFlipped(uint16 *dst, const byte *src, int n, const uint16 *pal) {
+	for (int i = 0; i < n; i++)
+		dst[-i] = pal[src[i]];
+}
+
 void RMGfxSourceBuffer8RLE::setAlphaBlendColor(int color) {
 	_alphaBlendColor = color;
 }
@@ -807,6 +835,10 @@ void RMGfxSourceBuffer8RLE::preparePalette() {
 	}
 }
 
+uint16 RMGfxSourceBuffer8RLE::halfAlphaColor() const {
+	return ((_alphaR >> 1) << 10) | ((_alphaG >> 1) << 5) | (_alphaB >> 1);
+}
+
 void RMGfxSourceBuffer8RLE::prepareImage() {
 	// Invoke the parent method
 	RMGfxSourceBuffer::prepareImage();
@@ -822,10 +854,9 @@ void RMGfxSourceBuffer8RLE::setAlreadyCompressed() {
 void RMGfxSourceBuffer8RLE::compressRLE() {
 	byte *startline;
 	byte *cur;
-	byte curdata;
 	byte *src;
 	byte *startsrc;
-	int rep;
+	byte *endsrc;
 
 	// Perform RLE compression for lines
 	cur = _megaRLEBuf;
@@ -837,41 +868,26 @@ void RMGfxSourceBuffer8RLE::compressRLE() {
 		// Leave space for the length of the line
 		cur += 2;
 
-		// It starts from the empty space
-		curdata = 0;
-		rep = 0;
-		startsrc = src;
-		for (int x = 0; x < _dimx;) {
-			if ((curdata == 0 && *src == 0) || (curdata == 1 && *src == _alphaBlendColor)
-			        || (curdata == 2 && (*src != _alphaBlendColor && *src != 0))) {
+		// Scan the line as a sequence of transparent, alpha and data runs
+		endsrc = src + _dimx;
+		while (src < endsrc) {
+			// Transparent pixels at the end of the line are left out
+			startsrc = src;
+			while (src < endsrc && *src == 0)
 				src++;
-				rep++;
-				x++;
-			} else {
-				if (curdata == 0) {
-					rleWriteTrasp(cur, rep);
-					curdata++;
-				} else if (curdata == 1) {
-					rleWriteAlphaBlend(cur, rep);
-					curdata++;
-				} else {
-					rleWriteData(cur, rep, startsrc);
-					curdata = 0;
-				}
+			if (src == endsrc)
+				break;
+			rleWriteTrasp(cur, src - startsrc);
 
-				rep = 0;
-				startsrc = src;
-			}
-		}
-
-		// Pending data?
-		if (curdata == 1) {
-			rleWriteAlphaBlend(cur, rep);
-			rleWriteData(cur, 0, NULL);
-		}
+			startsrc = src;
+			while (src < endsrc && *src == _alphaBlendColor)
+				src++;
+			rleWriteAlphaBlend(cur, src - startsrc);
 
-		if (curdata == 2) {
-			rleWriteData(cur, rep, startsrc);
+			startsrc = src;
+			while (src < endsrc && *src != 0 && *src != _alphaBlendColor)
+				src++;
+			rleWriteData(cur, src - startsrc, startsrc);
 		}
 
 		// End of line
@@ -988,6 +1004,7 @@ void RMGfxSourceBuffer8RLEByte::rleWriteEOL(byte *&cur) {
 
 void RMGfxSourceBuffer8RLEByte::rleDecompressLine(uint16 *dst, byte *src, int nStartSkip, int nLength) {
 	int n;
+	uint16 alpha = halfAlphaColor();
 
 	if (nStartSkip == 0)
 		goto RLEByteDoTrasp;
@@ -1055,17 +1072,8 @@ RLEByteDoAlpha:
 RLEByteDoAlpha2:
 		if (n > nLength)
 			n = nLength;
-		for (int i = 0; i < n; i++) {
-			int r = (*dst >> 10) & 0x1F;
-			int g = (*dst >> 5) & 0x1F;
-			int b = *dst & 0x1F;
-
-			r = (r >> 2) + (_alphaR >> 1);
-			g = (g >> 2) + (_alphaG >> 1);
-			b = (b >> 2) + (_alphaB >> 1);
-
-			*dst ++ = (r << 10) | (g << 5) | b;
-		}
+		rleAlphaRun(dst, n, alpha);
+		dst += n;
 
 		nLength -= n;
 		if (!nLength)
@@ -1080,8 +1088,9 @@ RLEByteDoCopy2:
 		if (n > nLength)
 			n = nLength;
 
-		for (int i = 0; i < n; i++)
-			*dst ++ = _palFinal[*src++];
+		rleCopyRun(dst, src, n, _palFinal);
+		dst += n;
+		src += n;
 
 		nLength -= n;
 		if (!nLength)
@@ -1092,6 +1101,7 @@ RLEByteDoCopy2:
 
 void RMGfxSourceBuffer8RLEByte::rleDecompressLineFlipped(uint16 *dst, byte *src, int nStartSkip, int nLength) {
 	int n;
+	uint16 alpha = halfAlphaColor();
 
 	if (nStartSkip == 0)
 		goto RLEByteFlippedDoTrasp;
@@ -1159,17 +1169,8 @@ RLEByteFlippedDoAlpha:
 RLEByteFlippedDoAlpha2:
 		if (n > nLength)
 			n = nLength;
-		for (int i = 0; i < n; i++) {
-			int r = (*dst >> 10) & 0x1F;
-			int g = (*dst >> 5) & 0x1F;
-			int b = *dst & 0x1F;
-
-			r = (r >> 2) + (_alphaR >> 1);
-			g = (g >> 2) + (_alphaG >> 1);
-			b = (b >> 2) + (_alphaB >> 1);
-
-			*dst-- = (r << 10) | (g << 5) | b;
-		}
+		rleAlphaRun(dst - n + 1, n, alpha);
+		dst -= n;
 
 		nLength -= n;
 		if (!nLength)
@@ -1184,8 +1185,9 @@ RLEByteFlippedDoCopy2:
 		if (n > nLength)
 			n = nLength;
 
-		for (int i = 0; i < n; i++)
-			*dst-- = _palFinal[*src++];
+		rleCopyRunFlipped(dst, src, n, _palFinal);
+		dst -= n;
+		src += n;
 
 		nLength -= n;
 		if (!nLength)
@@ -1229,6 +1231,7 @@ void RMGfxSourceBuffer8RLEWord::rleWriteEOL(byte *&cur) {
 
 void RMGfxSourceBuffer8RLEWord::rleDecompressLine(uint16 *dst, byte *src, int nStartSkip, int nLength) {
 	int n;
+	uint16 alpha = halfAlphaColor();
 
 	if (nStartSkip == 0)
 		goto RLEWordDoTrasp;
@@ -1303,17 +1306,8 @@ RLEWordDoAlpha2:
 		if (n > nLength)
 			n = nLength;
 
-		for (int i = 0; i < n; i++) {
-			int r = (*dst >> 10) & 0x1F;
-			int g = (*dst >> 5) & 0x1F;
-			int b = *dst & 0x1F;
-
-			r = (r >> 2) + (_alphaR >> 1);
-			g = (g >> 2) + (_alphaG >> 1);
-			b = (b >> 2) + (_alphaB >> 1);
-
-			*dst++ = (r << 10) | (g << 5) | b;
-		}
+		rleAlphaRun(dst, n, alpha);
+		dst += n;
 
 		nLength -= n;
 		if (!nLength)
@@ -1330,8 +1324,9 @@ RLEWordDoCopy2:
 		if (n > nLength)
 			n = nLength;
 
-		for (int i = 0; i < n; i++)
-			*dst++ = _palFinal[*src++];
+		rleCopyRun(dst, src, n, _palFinal);
+		dst += n;
+		src += n;
 
 		nLength -= n;
 		if (!nLength)
@@ -1343,6 +1338,7 @@ RLEWordDoCopy2:
 
 void RMGfxSourceBuffer8RLEWord::rleDecompressLineFlipped(uint16 *dst, byte *src, int nStartSkip, int nLength) {
 	int n;
+	uint16 alpha = halfAlphaColor();
 
 	if (nStartSkip == 0)
 		goto RLEWordFlippedDoTrasp;
@@ -1417,17 +1413,8 @@ RLEWordFlippedDoAlpha2:
 		if (n > nLength)
 			n = nLength;
 
-		for (int i = 0; i < n; i++) {
-			int r = (*dst >> 10) & 0x1F;
-			int g = (*dst >> 5) & 0x1F;
-			int b = *dst & 0x1F;
-
-			r = (r >> 2) + (_alphaR >> 1);
-			g = (g >> 2) + (_alphaG >> 1);
-			b = (b >> 2) + (_alphaB >> 1);
-
-			*dst-- = (r << 10) | (g << 5) | b;
-		}
+		rleAlphaRun(dst - n + 1, n, alpha);
+		dst -= n;
 
 		nLength -= n;
 		if (!nLength)
@@ -1444,8 +1431,9 @@ RLEWordFlippedDoCopy2:
 		if (n > nLength)
 			n = nLength;
 
-		for (int i = 0; i < n; i++)
-			*dst-- = _palFinal[*src++];
+		rleCopyRunFlipped(dst, src, n, _palFinal);
+		dst -= n;
+		src += n;
 
 		nLength -= n;
 		if (!nLength)
@@ -1470,6 +1458,8 @@ void RMGfxSourceBuffer8RLEWordAB::rleDecompressLine(uint16 *dst, byte *src,  int
 		return;
 	}
 
+	uint16 alpha = halfAlphaColor();
+
 	if (nStartSkip == 0)
 		goto RLEWordDoTrasp;
 
@@ -1544,17 +1534,8 @@ RLEWordDoAlpha2:
 			n = nLength;
 
 		// @@@ SHOULD NOT BE THERE !!!!!
-		for (int i = 0; i < n; i++) {
-			int r = (*dst >> 10) & 0x1F;
-			int g = (*dst >> 5) & 0x1F;
-			int b = *dst & 0x1F;
-
-			r = (r >> 2) + (_alphaR >> 1);
-			g = (g >> 2) + (_alphaG >> 1);
-			b = (b >> 2) + (_alphaB >> 1);
-
-			*dst++ = (r << 10) | (g << 5) | b;
-		}
+		rleAlphaRun(dst, n, alpha);
+		dst += n;
 
 		nLength -= n;
 		if (!nLength)
@@ -1571,22 +1552,9 @@ RLEWordDoCopy2:
 		if (n > nLength)
 			n = nLength;
 
-		for (int i = 0; i < n; i++) {
-			int r = (*dst >> 10) & 0x1F;
-			int g = (*dst >> 5) & 0x1F;
-			int b = *dst & 0x1F;
-
-			int r2 = (_palFinal[*src] >> 10) & 0x1F;
-			int g2 = (_palFinal[*src] >> 5) & 0x1F;
-			int b2 = _palFinal[*src] & 0x1F;
-
-			r = (r >> 1) + (r2 >> 1);
-			g = (g >> 1) + (g2 >> 1);
-			b = (b >> 1) + (b2 >> 1);
-
-			*dst ++ = (r << 10) | (g << 5) | b;
-			src++;
-		}
+		rleHalfBlendRun(dst, src, n, _palFinal);
+		dst += n;
+		src += n;
 
 		nLength -= n;
 		if (!nLength)
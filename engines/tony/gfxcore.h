@@ -302,6 +302,9 @@ protected:
 	// Perform image compression in RLE
 	void compressRLE();
 
+	// Blend color for alpha runs, with each channel already halved
+	uint16 halfAlphaColor() const;
+
 protected:
 	// Overriding initialization methods
 	virtual void prepareImage();
@@ -445,6 +448,7 @@ private:
 
 	bool _trackDirtyRects;
 	Common::List<Common::Rect> _currentDirtyRects, _previousDirtyRects, _dirtyRects;
+	uint32 _frameCount;
 
 	void mergeDirtyRects();
 
@@ -481,6 +485,9 @@ public:
 	void clearDirtyRects();
 	void setTrackDirtyRects(bool v);
 	bool getTrackDirtyRects() const;
+
+	// Number of frames finished with clearDirtyRects()
+	uint32 getFrameCount() const;
 };
 
 /**
@@ -1881,6 +1881,7 @@ RMLocation::RMLocation() {
 	_buf = NULL;
 	TEMPNumLoc = 0;
 	_cmode = CM_256;
+	_prevDrawFrame = 0;
 }
 
 RMPoint RMLocation::TEMPGetTonyStart() {
@@ -1903,6 +1904,7 @@ bool RMLocation::load(Common::SeekableReadStream &ds) {
 	// Reset dirty rectangling
 	_prevScroll.set(-1, -1);
 	_prevFixedScroll.set(-1, -1);
+	_prevDrawFrame = 0;
 
 	// Check the ID
 	ds.read(id, 3);
@@ -2039,18 +2041,74 @@ void RMLocation::draw(CORO_PARAM, RMGfxTargetBuffer &bigBuf, RMGfxPrimitive *pri
 	_ctx->hasChanges = (_prevScroll != _curScroll) || (_prevFixedScroll != _fixedScroll);
 	bigBuf.setTrackDirtyRects(_ctx->priorTracking && _ctx->hasChanges);
 
-	// Invoke the drawing method fo the image class, which will draw the location background
-	CORO_INVOKE_2(_buf->draw, bigBuf, prim);
+	if (!_ctx->hasChanges && _ctx->priorTracking && _cmode == CM_65K &&
+	        bigBuf.getFrameCount() == _prevDrawFrame + 1) {
+		// The background is still in place from the previous frame, except
+		// where something has been drawn over it since
+		restoreBackground(bigBuf, prim);
+	} else {
+		// Invoke the drawing method fo the image class, which will draw the location background
+		CORO_INVOKE_2(_buf->draw, bigBuf, prim);
+	}
 
 	if (_ctx->hasChanges) {
 		_prevScroll = _curScroll;
 		_prevFixedScroll = _fixedScroll;
 	}
+	_prevDrawFrame = bigBuf.getFrameCount();
 	bigBuf.setTrackDirtyRects(_ctx->priorTracking);
 
 	CORO_END_CODE;
 }
 
+void RMLocation::restoreBackground(RMGfxTargetBuffer &bigBuf, RMGfxPrimitive *prim) {
+	// Work out the screen area covered by the background
+	RMPoint srcOrigin(0, 0);
+	int width = _buf->getDimx();
+	int height = _buf->getDimy();
+	if (prim->haveSrc()) {
+		srcOrigin = prim->getSrc().topLeft();
+		width = prim->getSrc().width();
+		height = prim->getSrc().height();
+	}
+
+	Common::Rect area(_fixedScroll._x, _fixedScroll._y, _fixedScroll._x + width, _fixedScroll._y + height);
+	area.clip(RM_SX, RM_SY);
+	if (area.width() < 2 || area.height() < 2)
+		return;
+
+	const Common::List<Common::Rect> &dirtyRects = bigBuf.getDirtyRects();
+	Common::List<Common::Rect>::const_iterator i;
+	for (i = dirtyRects.begin(); i != dirtyRects.end(); ++i) {
+		Common::Rect r = *i;
+		r.clip(area);
+		if (r.isEmpty())
+			continue;
+
+		// Blits less than two pixels wide or high get rejected when clipping
+		if (r.width() < 2) {
+			if (r.right < area.right)
+				r.right++;
+			else
+				r.left--;
+		}
+		if (r.height() < 2) {
+			if (r.bottom < area.bottom)
+				r.bottom++;
+			else
+				r.top--;
+		}
+
+		int u = srcOrigin._x + r.left - _fixedScroll._x;
+		int v = srcOrigin._y + r.top - _fixedScroll._y;
+		RMPoint dst(r.left, r.top);
+		RMGfxPrimitive subPrim(_buf, RMRect(u, v, u + r.width(), v + r.height()), dst);
+
+		// A 16-bit background is drawn immediately, without yielding
+		_buf->draw(Common::nullContext, bigBuf, &subPrim);
+	}
+}
+
 /**
  * Prepare a frame, adding the location to the OT list, and all the items that have changed animation frame.
  */
@@ -494,6 +494,10 @@ private:
 
 	RMPoint _prevScroll;     // Previous scroll position
 	RMPoint _prevFixedScroll;
+	uint32 _prevDrawFrame;   // Frame in which the location was last drawn
+
+	// Redraw the background only where the target has been drawn over
+	void restoreBackground(RMGfxTargetBuffer &bigBuf, RMGfxPrimitive *prim);
 
 public:
 	// @@@@@@@@@@@@@@@@@@@@@@@
@@ -80,6 +80,7 @@ AdGame::AdGame(const Common::String &gameId) : BaseGame(gameId) {
 	_prevSceneFilename = NULL;
 	_scheduledScene = NULL;
 	_scheduledFadeIn = false;
+	_sceneStartTime = 0;
 
 
 	_stateEx = GAME_NORMAL;
@@ -141,6 +142,9 @@ bool AdGame::cleanup() {
 	unregisterObject(_scene);
 	_scene = NULL;
 
+	_scenePrefetch.clear();
+	_scenePrefetchOrder.clear();
+
 	// remove items
 	for (uint32 i = 0; i < _items.size(); i++) {
 		_gameRef->unregisterObject(_items[i]);
@@ -256,6 +260,30 @@ bool AdGame::removeObject(AdObject *object) {
 }
 
 
+//////////////////////////////////////////////////////////////////////////
+/**
+ * Remembers the images drawn by the scene being left. Only the most
+ * recently left scenes are kept.
+ */
+void AdGame::storeScenePrefetch(const Common::String &filename) {
+	static const uint kMaxPrefetchScenes = 8;
+
+	for (Common::List<Common::String>::iterator it = _scenePrefetchOrder.begin(); it != _scenePrefetchOrder.end(); ++it) {
+		if (it->equalsIgnoreCase(filename)) {
+			_scenePrefetchOrder.erase(it);
+			break;
+		}
+	}
+	_scenePrefetchOrder.push_back(filename);
+	_surfaceStorage->getDrawnSurfaces(_sceneStartTime, _scenePrefetch[filename]);
+
+	while (_scenePrefetchOrder.size() > kMaxPrefetchScenes) {
+		_scenePrefetch.erase(_scenePrefetchOrder.front());
+		_scenePrefetchOrder.pop_front();
+	}
+}
+
+
 //////////////////////////////////////////////////////////////////////////
 bool AdGame::changeScene(const char *filename, bool fadeIn) {
 	if (_scene == NULL) {
@@ -267,6 +295,10 @@ bool AdGame::changeScene(const char *filename, bool fadeIn) {
 		setPrevSceneName(_scene->getName());
 		setPrevSceneFilename(_scene->getFilename());
 
+		if (_scene->getFilename()) {
+			storeScenePrefetch(_scene->getFilename());
+		}
+
 		if (!_tempDisableSaveState) {
 			_scene->saveState();
 		}
@@ -302,6 +334,10 @@ bool AdGame::changeScene(const char *filename, bool fadeIn) {
 
 			_scene->loadState();
 		}
+		// The new scene holds its own references by now
+		_surfaceStorage->releasePrefetched();
+		_sceneStartTime = _liveTimer;
+
 		if (fadeIn) {
 			_gameRef->_transMgr->start(TRANSITION_FADE_IN);
 		}
@@ -1492,6 +1528,12 @@ bool AdGame::scheduleChangeScene(const char *filename, bool fadeIn) {
 
 		_scheduledFadeIn = fadeIn;
 
+		// Decode what the scene drew last time while this one fades out
+		ScenePrefetchMap::iterator it = _scenePrefetch.find(filename);
+		if (it != _scenePrefetch.end()) {
+			_surfaceStorage->prefetchSurfaces(it->_value);
+		}
+
 		return STATUS_OK;
 	}
 }
@@ -30,6 +30,7 @@
 
 #include "engines/wintermute/ad/ad_types.h"
 #include "engines/wintermute/base/base_game.h"
+#include "engines/wintermute/base/base_surface_storage.h"
 
 namespace Wintermute {
 class AdItem;
@@ -137,6 +138,12 @@ private:
 	BaseArray<AdInventory *> _inventories;
 	char *_scheduledScene;
 	bool _scheduledFadeIn;
+	/** The images each visited scene drew, prefetched while fading into it again. */
+	typedef Common::HashMap<Common::String, BaseSurfaceStorage::PrefetchList, Common::IgnoreCase_Hash, Common::IgnoreCase_EqualTo> ScenePrefetchMap;
+	ScenePrefetchMap _scenePrefetch;
+	Common::List<Common::String> _scenePrefetchOrder; // Least recently left first
+	void storeScenePrefetch(const Common::String &filename);
+	uint32 _sceneStartTime;
 	char *_prevSceneName;
 	char *_prevSceneFilename;
 	char *_debugStartupScene;
@@ -63,6 +63,9 @@
 
 namespace Wintermute {
 
+// how many lines the path finder remembers before it starts over
+static const uint32 kMaxCachedLines = 4096;
+
 IMPLEMENT_PERSISTENT(AdScene, false)
 
 //////////////////////////////////////////////////////////////////////////
@@ -90,6 +93,7 @@ void AdScene::setDefaults() {
 	_mainLayer = NULL;
 
 	_pfPointsNum = 0;
+	_pfRegionsHash = 0;
 	_persistentState = false;
 	_persistentStateSprites = true;
 
@@ -175,6 +179,7 @@ void AdScene::cleanup() {
 	}
 	_pfPath.clear();
 	_pfPointsNum = 0;
+	_pfLineCache.clear();
 
 	for (uint32 i = 0; i < _objects.size(); i++) {
 		_gameRef->unregisterObject(_objects[i]);
@@ -201,6 +206,13 @@ bool AdScene::getPath(BasePoint source, BasePoint target, AdPath *path, BaseObje
 		_pfTargetPath->reset();
 		_pfTargetPath->setReady(false);
 
+		// forget the cached lines if the scripts changed the regions
+		uint32 regionsHash = getRegionsHash();
+		if (regionsHash != _pfRegionsHash || _pfLineCache.size() > kMaxCachedLines) {
+			_pfLineCache.clear();
+			_pfRegionsHash = regionsHash;
+		}
+
 		// prepare working path
 		pfPointsStart();
 
@@ -334,8 +346,6 @@ uint32 AdScene::getAlphaAt(int x, int y, bool colorCheck) {
 
 //////////////////////////////////////////////////////////////////////////
 bool AdScene::isBlockedAt(int x, int y, bool checkFreeObjects, BaseObject *requester) {
-	bool ret = true;
-
 	if (checkFreeObjects) {
 		for (uint32 i = 0; i < _objects.size(); i++) {
 			if (_objects[i]->_active && _objects[i] != requester && _objects[i]->_currentBlockRegion) {
@@ -354,6 +364,13 @@ bool AdScene::isBlockedAt(int x, int y, bool checkFreeObjects, BaseObject *reque
 		}
 	}
 
+	return isBlockedByRegions(x, y);
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+bool AdScene::isBlockedByRegions(int x, int y) {
+	bool ret = true;
 
 	if (_mainLayer) {
 		for (uint32 i = 0; i < _mainLayer->_nodes.size(); i++) {
@@ -468,17 +485,139 @@ int AdScene::getPointsDist(BasePoint p1, BasePoint p2, BaseObject *requester) {
 }
 
 
+//////////////////////////////////////////////////////////////////////////
+AdScene::PfLineKey::PfLineKey(const BasePoint &p1, const BasePoint &p2) {
+	if (p1.x < p2.x || (p1.x == p2.x && p1.y < p2.y)) {
+		_x1 = p1.x;
+		_y1 = p1.y;
+		_x2 = p2.x;
+		_y2 = p2.y;
+	} else {
+		_x1 = p2.x;
+		_y1 = p2.y;
+		_x2 = p1.x;
+		_y2 = p1.y;
+	}
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+uint32 AdScene::getRegionsHash() {
+	uint32 hash = (uint32)(size_t)_mainLayer;
+	if (_mainLayer) {
+		for (uint32 i = 0; i < _mainLayer->_nodes.size(); i++) {
+			AdSceneNode *node = _mainLayer->_nodes[i];
+			if (node->_type != OBJECT_REGION) {
+				continue;
+			}
+			AdRegion *region = node->_region;
+			hash = hash * 31 + (uint32)(size_t)region;
+			hash = hash * 31 + (region->_active ? 1 : 0) + (region->_blocked ? 2 : 0) + (region->_decoration ? 4 : 0);
+			for (uint32 j = 0; j < region->_points.size(); j++) {
+				hash = hash * 31 + (uint16)region->_points[j]->x + ((uint16)region->_points[j]->y << 16);
+			}
+		}
+	}
+	return hash;
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+bool AdScene::isLineBlocked(BasePoint p1, BasePoint p2, const Common::Array<BaseRegion *> *blockRegions) {
+	// walks the same pixels as getPointsDist
+	int x1 = p1.x;
+	int y1 = p1.y;
+	int x2 = p2.x;
+	int y2 = p2.y;
+
+	int xLength = abs(x2 - x1);
+	int yLength = abs(y2 - y1);
+	bool xMajor = xLength > yLength;
+
+	if ((xMajor && x1 > x2) || (!xMajor && y1 > y2)) {
+		BaseUtils::swap(&x1, &x2);
+		BaseUtils::swap(&y1, &y2);
+	}
+
+	double step = xMajor ? (double)(y2 - y1) / (double)(x2 - x1) : (double)(x2 - x1) / (double)(y2 - y1);
+	double minor = xMajor ? y1 : x1;
+	int end = xMajor ? x2 : y2;
+
+	for (int major = xMajor ? x1 : y1; major < end; major++) {
+		int x = xMajor ? major : (int)minor;
+		int y = xMajor ? (int)minor : major;
+		if (blockRegions) {
+			for (uint32 i = 0; i < blockRegions->size(); i++) {
+				if ((*blockRegions)[i]->pointInRegion(x, y)) {
+					return true;
+				}
+			}
+		} else if (isBlockedByRegions(x, y)) {
+			return true;
+		}
+		minor += step;
+	}
+	return false;
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+/**
+ * Same as getPointsDist for the current path request, but only tests the
+ * pixels against the free objects near the line. The scene regions are
+ * tested once per line and the result is kept in _pfLineCache.
+ */
+int AdScene::pfGetPointsDist(const BasePoint &p1, const BasePoint &p2) {
+	PfLineKey key(p1, p2);
+	PfLineCache::iterator it = _pfLineCache.find(key);
+	bool blocked;
+	if (it != _pfLineCache.end()) {
+		blocked = it->_value;
+	} else {
+		blocked = isLineBlocked(p1, p2, NULL);
+		_pfLineCache[key] = blocked;
+	}
+	if (blocked) {
+		return -1;
+	}
+
+	// the block regions of the free objects move, so these are never cached
+	Common::Array<BaseRegion *> blockRegions;
+	AdGame *adGame = (AdGame *)_gameRef;
+	for (uint32 i = 0; i < _objects.size() + adGame->_objects.size(); i++) {
+		AdObject *obj = i < _objects.size() ? _objects[i] : adGame->_objects[i - _objects.size()];
+		if (!obj->_active || obj == _pfRequester || !obj->_currentBlockRegion) {
+			continue;
+		}
+		const Rect32 &rect = obj->_currentBlockRegion->_rect;
+		if (rect.left <= MAX(key._x1, key._x2) && rect.right >= MIN(key._x1, key._x2) &&
+		        rect.top <= MAX(key._y1, key._y2) && rect.bottom >= MIN(key._y1, key._y2)) {
+			blockRegions.push_back(obj->_currentBlockRegion);
+		}
+	}
+	if (!blockRegions.empty() && isLineBlocked(p1, p2, &blockRegions)) {
+		return -1;
+	}
+
+	return MAX(abs(p2.x - p1.x), abs(p2.y - p1.y));
+}
+
+
 //////////////////////////////////////////////////////////////////////////
 void AdScene::pathFinderStep() {
 	int i;
-	// get lowest unmarked
+	// get the unmarked point with the lowest estimated total distance (A*),
+	// the estimate being the distance to the target if it were in sight
 	int lowestDist = INT_MAX;
 	AdPathPoint *lowestPt = NULL;
 
 	for (i = 0; i < _pfPointsNum; i++)
-		if (!_pfPath[i]->_marked && _pfPath[i]->_distance < lowestDist) {
-			lowestDist = _pfPath[i]->_distance;
-			lowestPt = _pfPath[i];
+		if (!_pfPath[i]->_marked && _pfPath[i]->_distance != INT_MAX) {
+			int dist = _pfPath[i]->_distance + MAX(abs(_pfTarget->x - _pfPath[i]->x), abs(_pfTarget->y - _pfPath[i]->y));
+			if (dist < lowestDist) {
+				lowestDist = dist;
+				lowestPt = _pfPath[i];
+			}
 		}
 
 	if (lowestPt == NULL) { // no path -> terminate PathFinder
@@ -504,7 +643,12 @@ void AdScene::pathFinderStep() {
 	// otherwise keep on searching
 	for (i = 0; i < _pfPointsNum; i++)
 		if (!_pfPath[i]->_marked) {
-			int j = getPointsDist(*lowestPt, *_pfPath[i], _pfRequester);
+			// only trace the line if it could make the path shorter
+			int j = MAX(abs(_pfPath[i]->x - lowestPt->x), abs(_pfPath[i]->y - lowestPt->y));
+			if (lowestPt->_distance + j >= _pfPath[i]->_distance) {
+				continue;
+			}
+			j = pfGetPointsDist(*lowestPt, *_pfPath[i]);
 			if (j != -1 && lowestPt->_distance + j < _pfPath[i]->_distance) {
 				_pfPath[i]->_distance = lowestPt->_distance + j;
 				_pfPath[i]->_origin = lowestPt;
@@ -30,6 +30,7 @@
 #define WINTERMUTE_ADSCENE_H
 
 #include "engines/wintermute/base/base_fader.h"
+#include "common/hashmap.h"
 
 namespace Wintermute {
 
@@ -44,6 +45,7 @@ class AdPath;
 class AdScaleLevel;
 class AdRotLevel;
 class AdPathPoint;
+class BaseRegion;
 class AdScene : public BaseObject {
 public:
 
@@ -171,6 +173,31 @@ private:
 	BaseObject *_pfRequester;
 	BaseArray<AdPathPoint *> _pfPath;
 
+	/** A straight line between two points, with its end points in a fixed order. */
+	struct PfLineKey {
+		int32 _x1, _y1, _x2, _y2;
+
+		PfLineKey(const BasePoint &p1, const BasePoint &p2);
+		bool operator==(const PfLineKey &k) const {
+			return _x1 == k._x1 && _y1 == k._y1 && _x2 == k._x2 && _y2 == k._y2;
+		}
+	};
+	struct PfLineKeyHash {
+		uint operator()(const PfLineKey &k) const {
+			uint hash = (uint16)k._x1 + ((uint16)k._y1 << 16);
+			hash = hash * 31 + (uint16)k._x2 + ((uint16)k._y2 << 16);
+			return hash;
+		}
+	};
+	/** Whether the scene regions block each line, valid while _pfRegionsHash matches. */
+	typedef Common::HashMap<PfLineKey, bool, PfLineKeyHash> PfLineCache;
+	PfLineCache _pfLineCache;
+	uint32 _pfRegionsHash;
+	uint32 getRegionsHash();
+	int pfGetPointsDist(const BasePoint &p1, const BasePoint &p2);
+	bool isBlockedByRegions(int x, int y);
+	bool isLineBlocked(BasePoint p1, BasePoint p2, const Common::Array<BaseRegion *> *blockRegions);
+
 	int _offsetTop;
 	int _offsetLeft;
 
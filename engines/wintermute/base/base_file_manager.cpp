@@ -86,7 +86,8 @@ bool BaseFileManager::cleanup() {
 byte *BaseFileManager::readWholeFile(const Common::String &filename, uint32 *size, bool mustExist) {
 	byte *buffer = NULL;
 
-	Common::SeekableReadStream *file = openFile(filename);
+	// The stream never outlives this function, so there is no need to track it
+	Common::SeekableReadStream *file = openFile(filename, true, false);
 	if (!file) {
 		if (mustExist) {
 			debugC(kWintermuteDebugFileAccess | kWintermuteDebugLog, "Error opening file '%s'", filename.c_str());
@@ -94,25 +95,26 @@ byte *BaseFileManager::readWholeFile(const Common::String &filename, uint32 *siz
 		return NULL;
 	}
 
-	buffer = new byte[file->size() + 1];
+	uint32 fileSize = (uint32)file->size();
+	buffer = new byte[fileSize + 1];
 	if (buffer == NULL) {
-		debugC(kWintermuteDebugFileAccess | kWintermuteDebugLog, "Error allocating buffer for file '%s' (%d bytes)", filename.c_str(), file->size() + 1);
-		closeFile(file);
+		debugC(kWintermuteDebugFileAccess | kWintermuteDebugLog, "Error allocating buffer for file '%s' (%d bytes)", filename.c_str(), fileSize + 1);
+		delete file;
 		return NULL;
 	}
 
-	if (file->read(buffer, (uint32)file->size()) != (uint32)file->size()) {
+	if (file->read(buffer, fileSize) != fileSize) {
 		debugC(kWintermuteDebugFileAccess | kWintermuteDebugLog, "Error reading file '%s'", filename.c_str());
-		closeFile(file);
+		delete file;
 		delete[] buffer;
 		return NULL;
 	};
 
-	buffer[file->size()] = '\0';
+	buffer[fileSize] = '\0';
 	if (size != NULL) {
-		*size = file->size();
+		*size = fileSize;
 	}
-	closeFile(file);
+	delete file;
 
 	return buffer;
 }
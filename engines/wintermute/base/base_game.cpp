@@ -4352,6 +4352,11 @@ bool BaseGame::displayDebugInfo() {
 		sprintf(str, "Running scripts: %d (r:%d w:%d p:%d)", scrTotal, scrRunning, scrWaiting, scrPersistent);
 		_systemFont->drawText((byte *)str, 0, 70, _renderer->_width, TAL_RIGHT);
 
+		sprintf(str, "Script cache: %dKB (h:%d m:%d)", _scEngine->getScriptCacheSize() / 1024, _scEngine->_cacheHits, _scEngine->_cacheMisses);
+		_systemFont->drawText((byte *)str, 0, 90, _renderer->_width, TAL_RIGHT);
+
+		sprintf(str, "Surfaces: %d (h:%d m:%d)", _surfaceStorage->_surfaces.size(), _surfaceStorage->_hits, _surfaceStorage->_misses);
+		_systemFont->drawText((byte *)str, 0, 110, _renderer->_width, TAL_RIGHT);
 
 		sprintf(str, "Timer: %d", _timer);
 		_gameRef->_systemFont->drawText((byte *)str, 0, 130, _renderer->_width, TAL_RIGHT);
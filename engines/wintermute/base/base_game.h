@@ -247,6 +247,9 @@ public:
 
 	BaseSaveThumbHelper *_cachedThumbnail;
 	void addMem(int bytes);
+	uint32 getUsedMem() const {
+		return _usedMem;
+	}
 	bool _touchInterface;
 	bool _constrainedMemory;
 protected:
@@ -32,6 +32,8 @@
 #include "engines/wintermute/base/base_game.h"
 #include "engines/wintermute/base/base_file_manager.h"
 #include "engines/wintermute/platform_osystem.h"
+#include "common/config-manager.h"
+#include "common/system.h"
 #include "common/str.h"
 
 namespace Wintermute {
@@ -41,6 +43,13 @@ namespace Wintermute {
 //////////////////////////////////////////////////////////////////////
 BaseSurfaceStorage::BaseSurfaceStorage(BaseGame *inGame) : BaseClass(inGame) {
 	_lastCleanupTime = 0;
+	_hits = _misses = 0;
+
+	// Budget for surface memory in KB, 0 disables it
+	int budget = ConfMan.hasKey("surface_cache_size") ? ConfMan.getInt("surface_cache_size") : 65536;
+	_budget = (uint32)CLIP(budget, 0, 0x3FFFFF) * 1024;
+	_budgetStuckMem = 0;
+	_budgetStuckTime = 0;
 }
 
 
@@ -52,6 +61,8 @@ BaseSurfaceStorage::~BaseSurfaceStorage() {
 
 //////////////////////////////////////////////////////////////////////////
 bool BaseSurfaceStorage::cleanup(bool warn) {
+	_decodeQueue.clear();
+	_prefetched.clear();
 	for (uint32 i = 0; i < _surfaces.size(); i++) {
 		if (warn) {
 			_gameRef->LOG(0, "BaseSurfaceStorage warning: purging surface '%s', usage:%d", _surfaces[i]->getFileName(), _surfaces[i]->_referenceCount);
@@ -59,6 +70,7 @@ bool BaseSurfaceStorage::cleanup(bool warn) {
 		delete _surfaces[i];
 	}
 	_surfaces.clear();
+	_surfaceMap.clear();
 
 	return STATUS_OK;
 }
@@ -80,16 +92,144 @@ bool BaseSurfaceStorage::initLoop() {
 			}
 		}
 	}
+	if (_budget && _gameRef->getUsedMem() > _budget) {
+		// When the last pass could not free anything, wait for the memory
+		// usage to change or for the next cleanup cycle before trying again
+		if (_gameRef->getUsedMem() != _budgetStuckMem || _gameRef->_liveTimer - _budgetStuckTime >= _gameRef->_surfaceGCCycleTime) {
+			enforceBudget();
+		}
+	}
+	// Spend a slice of each frame on the prefetched surfaces
+	decodeQueued(10);
 	return STATUS_OK;
 }
 
 
+//////////////////////////////////////////////////////////////////////////
+void BaseSurfaceStorage::decodeQueued(uint32 timeSlice) {
+	uint32 startTime = g_system->getMillis();
+	while (!_decodeQueue.empty() && g_system->getMillis() - startTime < timeSlice) {
+		BaseSurface *surface = _decodeQueue.front();
+		_decodeQueue.pop_front();
+		surface->preload();
+		surface->_lastUsedTime = _gameRef->_liveTimer;
+	}
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+/**
+ * Lists the file based surfaces that were drawn since the given time, so
+ * that they can be prefetched when their scene is entered again.
+ */
+void BaseSurfaceStorage::getDrawnSurfaces(uint32 since, PrefetchList &list) {
+	list.clear();
+	for (uint32 i = 0; i < _surfaces.size(); i++) {
+		BaseSurface *surface = _surfaces[i];
+		if (surface->_valid && surface->_lastUsedTime >= since && !surface->_filename.empty()) {
+			PrefetchEntry entry;
+			entry._filename = surface->_filename;
+			entry._defaultCK = surface->_ckDefault;
+			entry._ckRed = surface->_ckRed;
+			entry._ckGreen = surface->_ckGreen;
+			entry._ckBlue = surface->_ckBlue;
+			entry._lifeTime = surface->_lifeTime;
+			entry._keepLoaded = surface->_keepLoaded;
+			list.push_back(entry);
+		}
+	}
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+/**
+ * Creates the listed surfaces and queues them for decoding in the coming
+ * frames. They are kept referenced until releasePrefetched is called.
+ */
+void BaseSurfaceStorage::prefetchSurfaces(const PrefetchList &list) {
+	for (uint32 i = 0; i < list.size(); i++) {
+		const PrefetchEntry &entry = list[i];
+		BaseSurface *surface = addSurface(entry._filename, entry._defaultCK, entry._ckRed, entry._ckGreen, entry._ckBlue, entry._lifeTime, entry._keepLoaded);
+		if (surface) {
+			_prefetched.push_back(surface);
+			if (!surface->_valid) {
+				_decodeQueue.push_back(surface);
+			}
+		}
+	}
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+void BaseSurfaceStorage::releasePrefetched() {
+	Common::Array<BaseSurface *> prefetched = _prefetched;
+	_prefetched.clear();
+	for (uint32 i = 0; i < prefetched.size(); i++) {
+		removeSurface(prefetched[i]);
+	}
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+bool BaseSurfaceStorage::isEvictable(const BaseSurface *surface) const {
+	// Only surfaces with a life time are meant to be unloaded, the others
+	// (including the keep-loaded ones) are always kept. Anything drawn this
+	// frame would be reloaded right away.
+	// Prefetched surfaces are kept until the scene they were fetched for
+	// has taken its own references, so their decoding is not wasted.
+	if (surface->_lifeTime <= 0 || !surface->_valid || surface->_lastUsedTime == _gameRef->_liveTimer) {
+		return false;
+	}
+	for (uint32 i = 0; i < _prefetched.size(); i++) {
+		if (_prefetched[i] == surface) {
+			return false;
+		}
+	}
+	return true;
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+void BaseSurfaceStorage::enforceBudget() {
+	bool freed = false;
+
+	// Only pay for the sort when there is something to evict
+	for (uint32 i = 0; i < _surfaces.size(); i++) {
+		if (isEvictable(_surfaces[i])) {
+			sortSurfaces();
+			for (uint32 j = 0; j < _surfaces.size() && _gameRef->getUsedMem() > _budget; j++) {
+				if (_surfaces[j]->_lifeTime <= 0) {
+					break;
+				}
+				if (isEvictable(_surfaces[j])) {
+					_surfaces[j]->invalidate();
+					freed = true;
+				}
+			}
+			break;
+		}
+	}
+
+	if (freed) {
+		_budgetStuckMem = 0;
+	} else {
+		_budgetStuckMem = _gameRef->getUsedMem();
+		_budgetStuckTime = _gameRef->_liveTimer;
+	}
+}
+
+
 //////////////////////////////////////////////////////////////////////
 bool BaseSurfaceStorage::removeSurface(BaseSurface *surface) {
 	for (uint32 i = 0; i < _surfaces.size(); i++) {
 		if (_surfaces[i] == surface) {
 			_surfaces[i]->_referenceCount--;
 			if (_surfaces[i]->_referenceCount <= 0) {
+				SurfaceMap::iterator it = _surfaceMap.find(_surfaces[i]->getFileNameStr());
+				if (it != _surfaceMap.end() && it->_value == _surfaces[i]) {
+					_surfaceMap.erase(it);
+				}
+				_decodeQueue.remove(_surfaces[i]);
 				delete _surfaces[i];
 				_surfaces.remove_at(i);
 			}
@@ -102,12 +242,13 @@ bool BaseSurfaceStorage::removeSurface(BaseSurface *surface) {
 
 //////////////////////////////////////////////////////////////////////
 BaseSurface *BaseSurfaceStorage::addSurface(const Common::String &filename, bool defaultCK, byte ckRed, byte ckGreen, byte ckBlue, int lifeTime, bool keepLoaded) {
-	for (uint32 i = 0; i < _surfaces.size(); i++) {
-		if (scumm_stricmp(_surfaces[i]->getFileName(), filename.c_str()) == 0) {
-			_surfaces[i]->_referenceCount++;
-			return _surfaces[i];
-		}
+	SurfaceMap::iterator it = _surfaceMap.find(filename);
+	if (it != _surfaceMap.end()) {
+		it->_value->_referenceCount++;
+		_hits++;
+		return it->_value;
 	}
+	_misses++;
 
 	if (!BaseFileManager::getEngineInstance()->hasFile(filename)) {
 		if (filename.size()) {
@@ -133,6 +274,7 @@ BaseSurface *BaseSurfaceStorage::addSurface(const Common::String &filename, bool
 	} else {
 		surface->_referenceCount = 1;
 		_surfaces.push_back(surface);
+		_surfaceMap[surface->getFileNameStr()] = surface;
 		return surface;
 	}
 }
@@ -176,33 +318,24 @@ bool BaseSurfaceStorage::sortSurfaces() {
 
 
 //////////////////////////////////////////////////////////////////////////
-int BaseSurfaceStorage::surfaceSortCB(const void *arg1, const void *arg2) {
-	const BaseSurface *s1 = *((const BaseSurface *const *)arg1);
-	const BaseSurface *s2 = *((const BaseSurface *const *)arg2);
-
+bool BaseSurfaceStorage::surfaceSortCB(const BaseSurface *s1, const BaseSurface *s2) {
 	// sort by life time
 	if (s1->_lifeTime <= 0 && s2->_lifeTime > 0) {
-		return 1;
+		return false;
 	} else if (s1->_lifeTime > 0 && s2->_lifeTime <= 0) {
-		return -1;
+		return true;
 	}
 
 
 	// sort by validity
 	if (s1->_valid && !s2->_valid) {
-		return -1;
+		return true;
 	} else if (!s1->_valid && s2->_valid) {
-		return 1;
+		return false;
 	}
 
 	// sort by time
-	else if (s1->_lastUsedTime > s2->_lastUsedTime) {
-		return 1;
-	} else if (s1->_lastUsedTime < s2->_lastUsedTime) {
-		return -1;
-	} else {
-		return 0;
-	}
+	return s1->_lastUsedTime < s2->_lastUsedTime;
 }
 
 } // end of namespace Wintermute
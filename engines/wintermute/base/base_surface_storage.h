@@ -31,6 +31,9 @@
 
 #include "engines/wintermute/base/base.h"
 #include "common/array.h"
+#include "common/hashmap.h"
+#include "common/hash-str.h"
+#include "common/list.h"
 
 namespace Wintermute {
 class BaseSurface;
@@ -39,7 +42,7 @@ public:
 	uint32 _lastCleanupTime;
 	bool initLoop();
 	bool sortSurfaces();
-	static int surfaceSortCB(const void *arg1, const void *arg2);
+	static bool surfaceSortCB(const BaseSurface *s1, const BaseSurface *s2);
 	bool cleanup(bool warn = false);
 	//DECLARE_PERSISTENT(BaseSurfaceStorage, BaseClass);
 
@@ -50,6 +53,37 @@ public:
 	virtual ~BaseSurfaceStorage();
 
 	Common::Array<BaseSurface *> _surfaces;
+
+	uint32 _hits;
+	uint32 _misses;
+
+	/** What is needed to recreate a surface, for prefetching it. */
+	struct PrefetchEntry {
+		Common::String _filename;
+		bool _defaultCK;
+		byte _ckRed;
+		byte _ckGreen;
+		byte _ckBlue;
+		int _lifeTime;
+		bool _keepLoaded;
+	};
+	typedef Common::Array<PrefetchEntry> PrefetchList;
+
+	void getDrawnSurfaces(uint32 since, PrefetchList &list);
+	void prefetchSurfaces(const PrefetchList &list);
+	void releasePrefetched();
+private:
+	void enforceBudget();
+	bool isEvictable(const BaseSurface *surface) const;
+	void decodeQueued(uint32 timeSlice);
+	Common::List<BaseSurface *> _decodeQueue;
+	Common::Array<BaseSurface *> _prefetched;
+
+	typedef Common::HashMap<Common::String, BaseSurface *, Common::IgnoreCase_Hash, Common::IgnoreCase_EqualTo> SurfaceMap;
+	SurfaceMap _surfaceMap;
+	uint32 _budget;
+	uint32 _budgetStuckMem;  // Memory usage when the last budget pass freed nothing
+	uint32 _budgetStuckTime;
 };
 
 } // end of namespace Wintermute
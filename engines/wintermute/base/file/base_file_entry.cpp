@@ -28,24 +28,103 @@
 
 #include "engines/wintermute/base/file/base_file_entry.h"
 #include "engines/wintermute/base/file/base_package.h"
+#include "common/mutex.h"
 #include "common/stream.h"
-#include "common/substream.h"
 #include "common/zlib.h"
 
 namespace Wintermute {
 
+/**
+ * A read stream for a range of a package file, which shares the open package
+ * file with the other members instead of opening it again for every member.
+ * The package file position is restored before every read, under a lock
+ * shared by all members, since sounds are read from the audio thread.
+ */
+class PackageMemberStream : public Common::SeekableReadStream {
+public:
+	PackageMemberStream(Common::SeekableReadStream *parent, Common::Mutex *mutex, uint32 begin, uint32 end)
+		: _parent(parent), _mutex(mutex), _begin(begin), _end(end), _pos(begin), _eos(false) {
+	}
+
+	virtual bool eos() const { return _eos; }
+	virtual bool err() const {
+		Common::StackLock lock(*_mutex);
+		return _parent->err();
+	}
+	virtual void clearErr() {
+		Common::StackLock lock(*_mutex);
+		_eos = false;
+		_parent->clearErr();
+	}
+	virtual int32 pos() const { return _pos - _begin; }
+	virtual int32 size() const { return _end - _begin; }
+
+	virtual bool seek(int32 offset, int whence = SEEK_SET) {
+		int64 newPos;
+		switch (whence) {
+		case SEEK_END:
+			newPos = (int64)size() + offset;
+			break;
+		case SEEK_SET:
+			newPos = offset;
+			break;
+		case SEEK_CUR:
+			newPos = (int64)pos() + offset;
+			break;
+		default:
+			return false;
+		}
+
+		// Positions outside the member are rejected, and leave the stream where it was
+		if (newPos < 0 || newPos > size()) {
+			return false;
+		}
+
+		_pos = _begin + (uint32)newPos;
+		_eos = false;
+		return true;
+	}
+
+	virtual uint32 read(void *dataPtr, uint32 dataSize) {
+		if (dataSize > _end - _pos) {
+			dataSize = _end - _pos;
+			_eos = true;
+		}
+		if (!dataSize) {
+			return 0;
+		}
+
+		Common::StackLock lock(*_mutex);
+		if (!_parent->seek(_pos)) {
+			return 0;
+		}
+		dataSize = _parent->read(dataPtr, dataSize);
+		_pos += dataSize;
+		return dataSize;
+	}
+
+private:
+	// Owned by the package, which outlives its member streams. Plain pointers
+	// are used since member streams get destroyed on the audio thread too.
+	Common::SeekableReadStream *_parent;
+	Common::Mutex *_mutex;
+	uint32 _begin;
+	uint32 _end;
+	uint32 _pos;
+	bool _eos;
+};
+
 Common::SeekableReadStream *BaseFileEntry::createReadStream() const {
-	Common::SeekableReadStream *file = _package->getFilePointer();
-	if (!file) {
+	Common::SeekableReadStream *package = _package->getFilePointer();
+	if (!package) {
 		return NULL;
 	}
 
 	bool compressed = (_compressedLength != 0);
 
+	Common::SeekableReadStream *file = new PackageMemberStream(package, &_package->getFileMutex(), _offset, _offset + _length);
 	if (compressed) {
-		file = Common::wrapCompressedReadStream(new Common::SeekableSubReadStream(file, _offset, _offset + _length, DisposeAfterUse::YES), _length); //
-	} else {
-		file = new Common::SeekableSubReadStream(file, _offset, _offset + _length, DisposeAfterUse::YES);
+		file = Common::wrapCompressedReadStream(file, _length);
 	}
 
 	file->seek(0);
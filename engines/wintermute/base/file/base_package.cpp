@@ -41,12 +41,22 @@ BasePackage::BasePackage() {
 	_cd = 0;
 	_priority = 0;
 	_boundToExe = false;
+	_file = NULL;
+}
+
+BasePackage::~BasePackage() {
+	delete _file;
 }
 
 Common::SeekableReadStream *BasePackage::getFilePointer() {
-	Common::SeekableReadStream *stream = _fsnode.createReadStream();
+	if (!_file) {
+		_file = _fsnode.createReadStream();
+	}
+	return _file;
+}
 
-	return stream;
+Common::Mutex &BasePackage::getFileMutex() {
+	return _fileMutex;
 }
 
 static bool findPackageSignature(Common::SeekableReadStream *f, uint32 *offset) {
@@ -32,17 +32,31 @@
 #include "common/archive.h"
 #include "common/stream.h"
 #include "common/fs.h"
+#include "common/mutex.h"
 
 namespace Wintermute {
 class BasePackage {
 public:
+	/**
+	 * Returns the package file, opened once and shared by all of its members.
+	 * It stays owned by the package, which outlives the member streams.
+	 */
 	Common::SeekableReadStream *getFilePointer();
+	/**
+	 * Returns the lock guarding the shared package file. Members are also read
+	 * from the audio thread, so every seek and read pair must hold it.
+	 */
+	Common::Mutex &getFileMutex();
 	Common::FSNode _fsnode;
 	bool _boundToExe;
 	byte _priority;
 	Common::String _name;
 	int _cd;
 	BasePackage();
+	~BasePackage();
+private:
+	Common::SeekableReadStream *_file;
+	Common::Mutex _fileMutex;
 };
 
 class PackageSet : public Common::Archive {
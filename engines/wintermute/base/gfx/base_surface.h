@@ -36,9 +36,14 @@
 namespace Wintermute {
 
 class BaseSurface: public BaseClass {
+	friend class BaseSurfaceStorage;
 public:
 	virtual bool invalidate();
 	virtual bool prepareToDraw();
+	/** Decodes a lazily loaded image now, instead of on its first use. */
+	virtual bool preload() {
+		return STATUS_OK;
+	}
 	uint32 _lastUsedTime;
 	bool _valid;
 	int _lifeTime;
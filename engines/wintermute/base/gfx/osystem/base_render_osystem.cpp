@@ -105,11 +105,24 @@ BaseRenderOSystem::BaseRenderOSystem(BaseGame *inGame) : BaseRenderer(inGame) {
 	_ratioX = _ratioY = 1.0f;
 	setAlphaMod(255);
 	setColorMod(255, 255, 255);
-	_dirtyRect = NULL;
+	_disableDirtyRects = ConfMan.hasKey("dirty_rects") && !ConfMan.getBool("dirty_rects");
+
+	// Budget of the scaled sprite cache in KB, 0 disables it
+	int budget = ConfMan.hasKey("scale_cache_size") ? ConfMan.getInt("scale_cache_size") : 4096;
+	_scaledSurfacesBudget = MAX(budget, 0) * 1024;
+	_scaledSurfacesSize = 0;
+	_scaledSurfacesClock = 0;
 }
 
 //////////////////////////////////////////////////////////////////////////
 BaseRenderOSystem::~BaseRenderOSystem() {
+	for (RenderQueueIterator it = _renderQueue.begin(); it != _renderQueue.end(); ++it) {
+		delete *it;
+	}
+	_renderQueue.clear();
+	_ticketMap.clear();
+	removeScaledSurfaces(NULL);
+
 	_renderSurface->free();
 	delete _renderSurface;
 	_blankSurface->free();
@@ -176,6 +189,9 @@ bool BaseRenderOSystem::initRenderer(int width, int height, bool windowed) {
 
 	_clearColor = _renderSurface->format.ARGBToColor(255, 0, 0, 0);
 
+	_screenRect = Common::Rect(_renderSurface->w, _renderSurface->h);
+	addDirtyRect(_screenRect);
+
 	return STATUS_OK;
 }
 
@@ -206,6 +222,7 @@ bool BaseRenderOSystem::flip() {
 		while (it != _renderQueue.end()) {
 			if ((*it)->_wantsDraw == false) {
 				RenderTicket *ticket = *it;
+				removeTicketKey(ticket);
 				it = _renderQueue.erase(it);
 				delete ticket;
 			} else {
@@ -218,9 +235,6 @@ bool BaseRenderOSystem::flip() {
 		if (_disableDirtyRects) {
 			g_system->copyRectToScreen((byte *)_renderSurface->pixels, _renderSurface->pitch, 0, 0, _renderSurface->w, _renderSurface->h);
 		}
-		//  g_system->copyRectToScreen((byte *)_renderSurface->pixels, _renderSurface->pitch, _dirtyRect->left, _dirtyRect->top, _dirtyRect->width(), _dirtyRect->height());
-		delete _dirtyRect;
-		_dirtyRect = NULL;
 		g_system->updateScreen();
 		_needsFlip = false;
 	}
@@ -231,10 +245,17 @@ bool BaseRenderOSystem::flip() {
 
 //////////////////////////////////////////////////////////////////////////
 bool BaseRenderOSystem::fill(byte r, byte g, byte b, Common::Rect *rect) {
-	_clearColor = _renderSurface->format.ARGBToColor(0xFF, r, g, b);
+	uint32 clearColor = _renderSurface->format.ARGBToColor(0xFF, r, g, b);
 	if (!_disableDirtyRects) {
+		// The clear color shows through everywhere no ticket covers,
+		// so changing it invalidates the whole screen.
+		if (clearColor != _clearColor) {
+			addDirtyRect(_screenRect);
+		}
+		_clearColor = clearColor;
 		return STATUS_OK;
 	}
+	_clearColor = clearColor;
 	if (!rect) {
 // TODO: This should speed things up, but for some reason it misses the size by quite a bit.
 /*		if (r == 0 && g == 0 && b == 0) {
@@ -259,14 +280,8 @@ void BaseRenderOSystem::fade(uint16 alpha) {
 
 //////////////////////////////////////////////////////////////////////////
 void BaseRenderOSystem::fadeToColor(byte r, byte g, byte b, byte a, Common::Rect *rect) {
-	// This particular warning is rather messy, as this function is called a ton,
-	// thus we avoid printing it more than once.
-
-	// TODO: Add fading with dirty rects.
-	if (!_disableDirtyRects) {
-		warning("BaseRenderOSystem::FadeToColor - Breaks when using dirty rects");
-	}
-
+	// Fades are drawn as owner-less tickets, which are never reused, so
+	// their area is redrawn every frame while the fade is active.
 	Common::Rect fillRect;
 
 	if (rect) {
@@ -292,8 +307,8 @@ void BaseRenderOSystem::fadeToColor(byte r, byte g, byte b, byte a, Common::Rect
 	Graphics::Surface surf;
 	surf.create((uint16)fillRect.width(), (uint16)fillRect.height(), _renderSurface->format);
 	Common::Rect sizeRect(fillRect);
-	sizeRect.translate(-fillRect.top, -fillRect.left);
-	surf.fillRect(fillRect, col);
+	sizeRect.translate(-fillRect.left, -fillRect.top);
+	surf.fillRect(sizeRect, col);
 	drawSurface(NULL, &surf, &sizeRect, &fillRect, false, false);
 	surf.free();
 
@@ -315,21 +330,29 @@ void BaseRenderOSystem::drawSurface(BaseSurfaceOSystem *owner, const Graphics::S
 	if (owner) { // Fade-tickets are owner-less
 		RenderTicket compare(owner, NULL, srcRect, dstRect, mirrorX, mirrorY, disableAlpha);
 		compare._colorMod = _colorMod;
-		RenderQueueIterator it;
-		for (it = _renderQueue.begin(); it != _renderQueue.end(); ++it) {
-			if ((*it)->_owner == owner && *(*it) == compare && (*it)->_isValid) {
-				(*it)->_colorMod = _colorMod;
-				if (_disableDirtyRects) {
-					drawFromSurface(*it, NULL);
-				} else {
-					drawFromTicket(*it);
-				}
-				return;
+		RenderTicketMap::iterator it = _ticketMap.find(RenderTicketKey(owner, *srcRect, *dstRect));
+		if (it != _ticketMap.end() && *(it->_value) == compare && it->_value->_isValid) {
+			if (_disableDirtyRects) {
+				it->_value->_wantsDraw = true;
+				drawFromSurface(it->_value, NULL);
+			} else {
+				drawFromTicket(it->_value);
 			}
+			return;
 		}
 	}
-	RenderTicket *ticket = new RenderTicket(owner, surf, srcRect, dstRect, mirrorX, mirrorY, disableAlpha);
+	RenderTicket *ticket;
+	if (owner && _scaledSurfacesBudget && (dstRect->width() != srcRect->width() || dstRect->height() != srcRect->height())) {
+		// A moving zoomed sprite gets a new ticket every frame, so keep its scaled copy around
+		const Graphics::Surface *scaled = getScaledSurface(owner, surf, *srcRect, dstRect->width(), dstRect->height());
+		Common::Rect scaledRect(scaled->w, scaled->h);
+		ticket = new RenderTicket(owner, scaled, &scaledRect, dstRect, mirrorX, mirrorY, disableAlpha);
+		ticket->_srcRect = *srcRect;
+	} else {
+		ticket = new RenderTicket(owner, surf, srcRect, dstRect, mirrorX, mirrorY, disableAlpha);
+	}
 	ticket->_colorMod = _colorMod;
+	addTicketKey(ticket);
 	if (!_disableDirtyRects) {
 		drawFromTicket(ticket);
 	} else {
@@ -340,12 +363,14 @@ void BaseRenderOSystem::drawSurface(BaseSurfaceOSystem *owner, const Graphics::S
 }
 
 void BaseRenderOSystem::invalidateTicket(RenderTicket *renderTicket) {
+	removeTicketKey(renderTicket);
 	addDirtyRect(renderTicket->_dstRect);
 	renderTicket->_isValid = false;
 //	renderTicket->_canDelete = true; // TODO: Maybe readd this, to avoid even more duplicates.
 }
 
 void BaseRenderOSystem::invalidateTicketsFromSurface(BaseSurfaceOSystem *surf) {
+	removeScaledSurfaces(surf);
 	RenderQueueIterator it;
 	for (it = _renderQueue.begin(); it != _renderQueue.end(); ++it) {
 		if ((*it)->_owner == surf) {
@@ -354,6 +379,70 @@ void BaseRenderOSystem::invalidateTicketsFromSurface(BaseSurfaceOSystem *surf) {
 	}
 }
 
+void BaseRenderOSystem::addTicketKey(RenderTicket *ticket) {
+	// Fade-tickets are owner-less, and never reused
+	if (ticket->_owner) {
+		_ticketMap[RenderTicketKey(ticket->_owner, ticket->_srcRect, ticket->_dstRect)] = ticket;
+	}
+}
+
+void BaseRenderOSystem::removeTicketKey(RenderTicket *ticket) {
+	if (!ticket->_owner) {
+		return;
+	}
+	RenderTicketMap::iterator it = _ticketMap.find(RenderTicketKey(ticket->_owner, ticket->_srcRect, ticket->_dstRect));
+	// A newer ticket with the same key may have taken over the entry
+	if (it != _ticketMap.end() && it->_value == ticket) {
+		_ticketMap.erase(it);
+	}
+}
+
+const Graphics::Surface *BaseRenderOSystem::getScaledSurface(BaseSurfaceOSystem *owner, const Graphics::Surface *surf, const Common::Rect &srcRect, int16 width, int16 height) {
+	RenderTicketKey key(owner, srcRect, Common::Rect(width, height));
+	ScaledSurfaceMap::iterator it = _scaledSurfaces.find(key);
+	if (it != _scaledSurfaces.end()) {
+		it->_value._lastUse = ++_scaledSurfacesClock;
+		return it->_value._surface;
+	}
+
+	TransparentSurface src(*surf, false);
+	ScaledSurface scaled;
+	scaled._surface = src.scale(srcRect, Common::Rect(width, height));
+	scaled._lastUse = ++_scaledSurfacesClock;
+	_scaledSurfaces[key] = scaled;
+	_scaledSurfacesSize += scaled._surface->pitch * scaled._surface->h;
+
+	// Evict the least recently used copies, but always keep the new one
+	while (_scaledSurfacesSize > _scaledSurfacesBudget && _scaledSurfaces.size() > 1) {
+		ScaledSurfaceMap::iterator oldest = _scaledSurfaces.end();
+		for (it = _scaledSurfaces.begin(); it != _scaledSurfaces.end(); ++it) {
+			if (it->_value._surface != scaled._surface && (oldest == _scaledSurfaces.end() || it->_value._lastUse < oldest->_value._lastUse)) {
+				oldest = it;
+			}
+		}
+		Graphics::Surface *surface = oldest->_value._surface;
+		_scaledSurfacesSize -= surface->pitch * surface->h;
+		surface->free();
+		delete surface;
+		_scaledSurfaces.erase(oldest);
+	}
+	return scaled._surface;
+}
+
+void BaseRenderOSystem::removeScaledSurfaces(BaseSurfaceOSystem *owner) {
+	// A NULL owner removes all of them
+	ScaledSurfaceMap::iterator it;
+	for (it = _scaledSurfaces.begin(); it != _scaledSurfaces.end(); ++it) {
+		if (!owner || it->_key._owner == owner) {
+			Graphics::Surface *surface = it->_value._surface;
+			_scaledSurfacesSize -= surface->pitch * surface->h;
+			surface->free();
+			delete surface;
+			_scaledSurfaces.erase(it);
+		}
+	}
+}
+
 void BaseRenderOSystem::drawFromTicket(RenderTicket *renderTicket) {
 	renderTicket->_wantsDraw = true;
 	// A new item always has _drawNum == 0
@@ -410,12 +499,43 @@ void BaseRenderOSystem::drawFromTicket(RenderTicket *renderTicket) {
 }
 
 void BaseRenderOSystem::addDirtyRect(const Common::Rect &rect) {
-	if (!_dirtyRect) {
-		_dirtyRect = new Common::Rect(rect);
-	} else {
-		_dirtyRect->extend(rect);
+	Common::Rect dirty(rect);
+	dirty.clip(_screenRect);
+	if (dirty.isEmpty()) {
+		return;
 	}
-	_dirtyRect->clip(_renderRect);
+	// Merge overlapping rects, so that no pixel is redrawn twice.
+	bool merged;
+	do {
+		merged = false;
+		Common::List<Common::Rect>::iterator it = _dirtyRects.begin();
+		while (it != _dirtyRects.end()) {
+			if (it->intersects(dirty)) {
+				dirty.extend(*it);
+				it = _dirtyRects.erase(it);
+				merged = true;
+			} else {
+				++it;
+			}
+		}
+	} while (merged);
+	_dirtyRects.push_back(dirty);
+
+	// Past a handful of rects, redrawing the overlapping tickets for each
+	// costs more than redrawing their bounding box once.
+	if (_dirtyRects.size() > kMaxDirtyRects) {
+		Common::List<Common::Rect>::iterator it = _dirtyRects.begin();
+		Common::Rect bounds(*it);
+		for (++it; it != _dirtyRects.end(); ++it) {
+			bounds.extend(*it);
+		}
+		_dirtyRects.clear();
+		_dirtyRects.push_back(bounds);
+	}
+}
+
+static Common::Rect lineRect(const Common::Point &p1, const Common::Point &p2) {
+	return Common::Rect(MIN(p1.x, p2.x), MIN(p1.y, p2.y), MAX(p1.x, p2.x) + 1, MAX(p1.y, p2.y) + 1);
 }
 
 void BaseRenderOSystem::drawTickets() {
@@ -426,6 +546,7 @@ void BaseRenderOSystem::drawTickets() {
 		if ((*it)->_wantsDraw == false || (*it)->_isValid == false) {
 			RenderTicket *ticket = *it;
 			addDirtyRect((*it)->_dstRect);
+			removeTicketKey(ticket);
 			it = _renderQueue.erase(it);
 			delete ticket;
 			decrement++;
@@ -434,42 +555,63 @@ void BaseRenderOSystem::drawTickets() {
 			++it;
 		}
 	}
-	if (!_dirtyRect || _dirtyRect->width() == 0 || _dirtyRect->height() == 0) {
-		return;
+	// Lines only last a single frame, so erase the ones from the last one.
+	for (uint i = 0; i < _lastLineRects.size(); i++) {
+		addDirtyRect(_lastLineRects[i]);
 	}
-	// The color-mods are stored in the RenderTickets on add, since we set that state again during
-	// draw, we need to keep track of what it was prior to draw.
-	uint32 oldColorMod = _colorMod;
+	_lastLineRects.clear();
+
+	if (!_dirtyRects.empty()) {
+		// The color-mods are stored in the RenderTickets on add, since we set that state again during
+		// draw, we need to keep track of what it was prior to draw.
+		uint32 oldColorMod = _colorMod;
+
+		Common::List<Common::Rect>::iterator dirty;
+		for (dirty = _dirtyRects.begin(); dirty != _dirtyRects.end(); ++dirty) {
+			// Apply the clear-color to the dirty rect.
+			_renderSurface->fillRect(*dirty, _clearColor);
+			for (it = _renderQueue.begin(); it != _renderQueue.end(); ++it) {
+				RenderTicket *ticket = *it;
+				if (ticket->_isValid && ticket->_dstRect.intersects(*dirty)) {
+					// dstClip is the area we want redrawn.
+					Common::Rect dstClip(ticket->_dstRect);
+					// reduce it to the dirty rect
+					dstClip.clip(*dirty);
+					// we need to keep track of the position to redraw the dirty rect
+					Common::Rect pos(dstClip);
+					int16 offsetX = ticket->_dstRect.left;
+					int16 offsetY = ticket->_dstRect.top;
+					// convert from screen-coords to surface-coords.
+					dstClip.translate(-offsetX, -offsetY);
+
+					_colorMod = ticket->_colorMod;
+					drawFromSurface(ticket->getSurface(), &ticket->_srcRect, &pos, &dstClip, ticket->_mirror);
+				}
+			}
+		}
+		// The line rects were marked dirty when the lines were queued
+		for (uint i = 0; i < _lineQueue.size(); i++) {
+			const RenderLine &line = _lineQueue[i];
+			_renderSurface->drawLine(line._p1.x, line._p1.y, line._p2.x, line._p2.y, line._color);
+			_lastLineRects.push_back(lineRect(line._p1, line._p2));
+		}
+		for (dirty = _dirtyRects.begin(); dirty != _dirtyRects.end(); ++dirty) {
+			g_system->copyRectToScreen((byte *)_renderSurface->getBasePtr(dirty->left, dirty->top), _renderSurface->pitch, dirty->left, dirty->top, dirty->width(), dirty->height());
+		}
+		_dirtyRects.clear();
+		_needsFlip = true;
+
+		// Revert the colorMod-state.
+		_colorMod = oldColorMod;
+	}
+	_lineQueue.clear();
 
-	// Apply the clear-color to the dirty rect.
-	_renderSurface->fillRect(*_dirtyRect, _clearColor);
 	_drawNum = 1;
 	for (it = _renderQueue.begin(); it != _renderQueue.end(); ++it) {
-		RenderTicket *ticket = *it;
-		assert(ticket->_drawNum == _drawNum++);
-		if (ticket->_isValid && ticket->_dstRect.intersects(*_dirtyRect)) {
-			// dstClip is the area we want redrawn.
-			Common::Rect dstClip(ticket->_dstRect);
-			// reduce it to the dirty rect
-			dstClip.clip(*_dirtyRect);
-			// we need to keep track of the position to redraw the dirty rect
-			Common::Rect pos(dstClip);
-			int16 offsetX = ticket->_dstRect.left;
-			int16 offsetY = ticket->_dstRect.top;
-			// convert from screen-coords to surface-coords.
-			dstClip.translate(-offsetX, -offsetY);
-
-			_colorMod = ticket->_colorMod;
-			drawFromSurface(ticket->getSurface(), &ticket->_srcRect, &pos, &dstClip, ticket->_mirror);
-			_needsFlip = true;
-		}
-		// Some tickets want redraw but don't actually clip the dirty area (typically the ones that shouldnt become clear-color)
-		ticket->_wantsDraw = false;
+		assert((*it)->_drawNum == _drawNum++);
+		// Tickets have to ask to be drawn again next frame, or they are removed
+		(*it)->_wantsDraw = false;
 	}
-	g_system->copyRectToScreen((byte *)_renderSurface->getBasePtr(_dirtyRect->left, _dirtyRect->top), _renderSurface->pitch, _dirtyRect->left, _dirtyRect->top, _dirtyRect->width(), _dirtyRect->height());
-
-	// Revert the colorMod-state.
-	_colorMod = oldColorMod;
 }
 
 // Replacement for SDL2's SDL_RenderCopy
@@ -507,11 +649,6 @@ void BaseRenderOSystem::drawFromSurface(const Graphics::Surface *surf, Common::R
 
 //////////////////////////////////////////////////////////////////////////
 bool BaseRenderOSystem::drawLine(int x1, int y1, int x2, int y2, uint32 color) {
-
-	if (!_disableDirtyRects) {
-		warning("BaseRenderOSystem::DrawLine - doesn't work for dirty rects yet");
-	}
-
 	byte r = RGBCOLGetR(color);
 	byte g = RGBCOLGetG(color);
 	byte b = RGBCOLGetB(color);
@@ -531,6 +668,16 @@ bool BaseRenderOSystem::drawLine(int x1, int y1, int x2, int y2, uint32 color) {
 
 	// TODO: This thing is mostly here until I'm sure about the final color-format.
 	uint32 colorVal = _renderSurface->format.ARGBToColor(a, r, g, b);
+	if (!_disableDirtyRects) {
+		// Drawn directly as well, for indicatorFlip, but has to be
+		// replayed after the tickets are redrawn at flip.
+		RenderLine line;
+		line._p1 = Common::Point(point1.x, point1.y);
+		line._p2 = Common::Point(point2.x, point2.y);
+		line._color = colorVal;
+		_lineQueue.push_back(line);
+		addDirtyRect(lineRect(line._p1, line._p2));
+	}
 	_renderSurface->drawLine(point1.x, point1.y, point2.x, point2.y, colorVal);
 	//SDL_RenderDrawLine(_renderer, point1.x, point1.y, point2.x, point2.y);
 	return STATUS_OK;
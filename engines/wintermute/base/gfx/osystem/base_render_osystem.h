@@ -33,6 +33,8 @@
 #include "common/rect.h"
 #include "graphics/surface.h"
 #include "common/list.h"
+#include "common/array.h"
+#include "common/hashmap.h"
 
 namespace Wintermute {
 class BaseSurfaceOSystem;
@@ -57,6 +59,30 @@ public:
 	bool operator==(RenderTicket &a);
 };
 
+/** Identifies the tickets a draw-call may reuse. */
+struct RenderTicketKey {
+	BaseSurfaceOSystem *_owner;
+	Common::Rect _srcRect;
+	Common::Rect _dstRect;
+
+	RenderTicketKey(BaseSurfaceOSystem *owner, const Common::Rect &srcRect, const Common::Rect &dstRect) :
+		_owner(owner), _srcRect(srcRect), _dstRect(dstRect) {}
+	bool operator==(const RenderTicketKey &k) const {
+		return _owner == k._owner && _srcRect == k._srcRect && _dstRect == k._dstRect;
+	}
+};
+
+struct RenderTicketKeyHash {
+	uint operator()(const RenderTicketKey &k) const {
+		uint hash = (uint)(size_t)k._owner;
+		hash = hash * 31 + (uint16)k._srcRect.left + ((uint16)k._srcRect.top << 16);
+		hash = hash * 31 + (uint16)k._srcRect.right + ((uint16)k._srcRect.bottom << 16);
+		hash = hash * 31 + (uint16)k._dstRect.left + ((uint16)k._dstRect.top << 16);
+		hash = hash * 31 + (uint16)k._dstRect.right + ((uint16)k._dstRect.bottom << 16);
+		return hash;
+	}
+};
+
 class BaseRenderOSystem : public BaseRenderer {
 public:
 	BaseRenderOSystem(BaseGame *inGame);
@@ -101,13 +127,39 @@ public:
 	void drawSurface(BaseSurfaceOSystem *owner, const Graphics::Surface *surf, Common::Rect *srcRect, Common::Rect *dstRect, bool mirrorX, bool mirrorY, bool disableAlpha = false);
 	BaseSurface *createSurface();
 private:
+	/** A line drawn since the last flip, replayed on top of the tickets. */
+	struct RenderLine {
+		Common::Point _p1;
+		Common::Point _p2;
+		uint32 _color;
+	};
+
 	void addDirtyRect(const Common::Rect &rect);
 	void drawTickets();
 	void drawFromSurface(RenderTicket *ticket, Common::Rect *clipRect);
 	void drawFromSurface(const Graphics::Surface *surf, Common::Rect *srcRect, Common::Rect *dstRect, Common::Rect *clipRect, uint32 mirror);
+	void addTicketKey(RenderTicket *ticket);
+	void removeTicketKey(RenderTicket *ticket);
+	const Graphics::Surface *getScaledSurface(BaseSurfaceOSystem *owner, const Graphics::Surface *surf, const Common::Rect &srcRect, int16 width, int16 height);
+	void removeScaledSurfaces(BaseSurfaceOSystem *owner);
 	typedef Common::List<RenderTicket *>::iterator RenderQueueIterator;
-	Common::Rect *_dirtyRect;
+	typedef Common::HashMap<RenderTicketKey, RenderTicket *, RenderTicketKeyHash> RenderTicketMap;
+	/** A scaled copy of part of a surface, keyed by its source rect and size. */
+	struct ScaledSurface {
+		Graphics::Surface *_surface;
+		uint32 _lastUse;
+	};
+	typedef Common::HashMap<RenderTicketKey, ScaledSurface, RenderTicketKeyHash> ScaledSurfaceMap;
+	Common::List<Common::Rect> _dirtyRects;
 	Common::List<RenderTicket *> _renderQueue;
+	RenderTicketMap _ticketMap;
+	Common::Array<RenderLine> _lineQueue;
+	Common::Array<Common::Rect> _lastLineRects;
+	Common::Rect _screenRect;
+	ScaledSurfaceMap _scaledSurfaces;
+	uint32 _scaledSurfacesSize;
+	uint32 _scaledSurfacesBudget;
+	uint32 _scaledSurfacesClock;
 	bool _needsFlip;
 	uint32 _drawNum;
 	Common::Rect _renderRect;
@@ -119,7 +171,8 @@ private:
 	int _borderRight;
 	int _borderBottom;
 
-	static const bool _disableDirtyRects = true;
+	bool _disableDirtyRects;
+	static const uint kMaxDirtyRects = 16;
 	float _ratioX;
 	float _ratioY;
 	uint32 _colorMod;
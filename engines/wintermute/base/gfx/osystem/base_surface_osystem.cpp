@@ -65,9 +65,39 @@ BaseSurfaceOSystem::~BaseSurfaceOSystem() {
 	delete[] _alphaMask;
 	_alphaMask = NULL;
 
+	if (_valid) {
+		_gameRef->addMem(-_width * _height * 4);
+	}
+	BaseRenderOSystem *renderer = static_cast<BaseRenderOSystem *>(_gameRef->_renderer);
+	renderer->invalidateTicketsFromSurface(this);
+}
+
+//////////////////////////////////////////////////////////////////////////
+bool BaseSurfaceOSystem::invalidate() {
+	// Only surfaces loaded from a file can be brought back by finishLoad
+	if (!_loaded || !_valid || _filename.empty()) {
+		return STATUS_FAILED;
+	}
+
+	_surface->free();
+	delete[] _alphaMask;
+	_alphaMask = NULL;
+
 	_gameRef->addMem(-_width * _height * 4);
+	_loaded = false;
+	_valid = false;
+
 	BaseRenderOSystem *renderer = static_cast<BaseRenderOSystem *>(_gameRef->_renderer);
 	renderer->invalidateTicketsFromSurface(this);
+	return STATUS_OK;
+}
+
+//////////////////////////////////////////////////////////////////////////
+bool BaseSurfaceOSystem::preload() {
+	if (!_loaded && !_filename.empty()) {
+		finishLoad();
+	}
+	return STATUS_OK;
 }
 
 bool hasTransparency(Graphics::Surface *surf) {
@@ -75,12 +105,12 @@ bool hasTransparency(Graphics::Surface *surf) {
 		warning("hasTransparency:: non 32 bpp surface passed as argument");
 		return false;
 	}
-	uint8 r, g, b, a;
+	// Compare the alpha bits directly, rather than unpacking every pixel
+	const uint32 alphaMask = (0xFF >> surf->format.aLoss) << surf->format.aShift;
 	for (int i = 0; i < surf->h; i++) {
+		const uint32 *pix = (const uint32 *)surf->getBasePtr(0, i);
 		for (int j = 0; j < surf->w; j++) {
-			uint32 pix = *(uint32 *)surf->getBasePtr(j, i);
-			surf->format.colorToARGB(pix, a, r, g, b);
-			if (a != 255) {
+			if ((pix[j] & alphaMask) != alphaMask) {
 				return true;
 			}
 		}
@@ -273,6 +303,10 @@ bool BaseSurfaceOSystem::isTransparentAt(int x, int y) {
 
 //////////////////////////////////////////////////////////////////////////
 bool BaseSurfaceOSystem::isTransparentAtLite(int x, int y) {
+	if (!_loaded && !_filename.empty()) {
+		finishLoad();
+	}
+
 	if (x < 0 || x >= _surface->w || y < 0 || y >= _surface->h) {
 		return true;
 	}
@@ -347,6 +381,7 @@ bool BaseSurfaceOSystem::drawSprite(int x, int y, Rect32 *rect, float zoomX, flo
 	if (!_loaded) {
 		finishLoad();
 	}
+	_lastUsedTime = _gameRef->_liveTimer;
 
 	if (renderer->_forceAlphaColor != 0) {
 		alpha = renderer->_forceAlphaColor;
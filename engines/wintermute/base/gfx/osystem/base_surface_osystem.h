@@ -43,6 +43,8 @@ public:
 
 	bool create(const Common::String &filename, bool defaultCK, byte ckRed, byte ckGreen, byte ckBlue, int lifeTime = -1, bool keepLoaded = false);
 	bool create(int width, int height);
+	bool invalidate();
+	bool preload();
 
 	bool isTransparentAt(int x, int y);
 	bool isTransparentAtLite(int x, int y);
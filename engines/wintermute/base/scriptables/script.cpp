@@ -46,6 +46,7 @@ ScScript::ScScript(BaseGame *inGame, ScEngine *engine) : BaseClass(inGame) {
 	_currentLine = 0;
 
 	_symbols = NULL;
+	_symbolKeys = NULL;
 	_numSymbols = 0;
 
 	_engine = engine;
@@ -173,6 +174,11 @@ bool ScScript::initTables() {
 		uint32 index = getDWORD();
 		_symbols[index] = getString();
 	}
+	// Variables are looked up by symbol, so build their hash keys only once
+	_symbolKeys = new AnsiString[_numSymbols];
+	for (uint32 i = 0; i < _numSymbols; i++) {
+		_symbolKeys[i] = _symbols[i];
+	}
 
 	// load functions table
 	_iP = _header.funcTable;
@@ -394,6 +400,8 @@ void ScScript::cleanup() {
 		delete[] _symbols;
 	}
 	_symbols = NULL;
+	delete[] _symbolKeys;
+	_symbolKeys = NULL;
 	_numSymbols = 0;
 
 	if (_globals && !_thread) {
@@ -581,9 +589,7 @@ bool ScScript::executeInstruction() {
 	case II_CALL_BY_EXP: {
 		// push var
 		// push string
-		str = _stack->pop()->getString();
-		char *methodName = new char[strlen(str) + 1];
-		strcpy(methodName, str);
+		AnsiString methodName = _stack->pop()->getString();
 
 		ScValue *var = _stack->pop();
 		if (var->_type == VAL_VARIABLE_REF) {
@@ -594,18 +600,22 @@ bool ScScript::executeInstruction() {
 		bool triedNative = false;
 
 		// we are already calling this method, try native
-		if (_thread && _methodThread && strcmp(methodName, _threadEvent) == 0 && var->_type == VAL_NATIVE && _owner == var->getNative()) {
+		if (_engine->getIsProfiling()) {
+			_engine->addMethodCall(methodName.c_str());
+		}
+
+		if (_thread && _methodThread && strcmp(methodName.c_str(), _threadEvent) == 0 && var->_type == VAL_NATIVE && _owner == var->getNative()) {
 			triedNative = true;
-			res = var->_valNative->scCallMethod(this, _stack, _thisStack, methodName);
+			res = var->_valNative->scCallMethod(this, _stack, _thisStack, methodName.c_str());
 		}
 
 		if (DID_FAIL(res)) {
-			if (var->isNative() && var->getNative()->canHandleMethod(methodName)) {
+			if (var->isNative() && var->getNative()->canHandleMethod(methodName.c_str())) {
 				if (!_unbreakable) {
-					_waitScript = var->getNative()->invokeMethodThread(methodName);
+					_waitScript = var->getNative()->invokeMethodThread(methodName.c_str());
 					if (!_waitScript) {
 						_stack->correctParams(0);
-						runtimeError("Error invoking method '%s'.", methodName);
+						runtimeError("Error invoking method '%s'.", methodName.c_str());
 						_stack->pushNULL();
 					} else {
 						_state = SCRIPT_WAITING_SCRIPT;
@@ -614,10 +624,9 @@ bool ScScript::executeInstruction() {
 				} else {
 					// can call methods in unbreakable mode
 					_stack->correctParams(0);
-					runtimeError("Cannot call method '%s'. Ignored.", methodName);
+					runtimeError("Cannot call method '%s'. Ignored.", methodName.c_str());
 					_stack->pushNULL();
 				}
-				delete[] methodName;
 				break;
 			}
 			/*
@@ -644,17 +653,16 @@ bool ScScript::executeInstruction() {
 			else {
 				res = STATUS_FAILED;
 				if (var->_type == VAL_NATIVE && !triedNative) {
-					res = var->_valNative->scCallMethod(this, _stack, _thisStack, methodName);
+					res = var->_valNative->scCallMethod(this, _stack, _thisStack, methodName.c_str());
 				}
 
 				if (DID_FAIL(res)) {
 					_stack->correctParams(0);
-					runtimeError("Call to undefined method '%s'. Ignored.", methodName);
+					runtimeError("Call to undefined method '%s'. Ignored.", methodName.c_str());
 					_stack->pushNULL();
 				}
 			}
 		}
-		delete[] methodName;
 	}
 	break;
 
@@ -690,7 +698,7 @@ bool ScScript::executeInstruction() {
 		break;
 
 	case II_PUSH_VAR: {
-		ScValue *var = getVar(_symbols[getDWORD()]);
+		ScValue *var = getVar(getDWORD());
 		if (false && /*var->_type==VAL_OBJECT ||*/ var->_type == VAL_NATIVE) {
 			_operand->setReference(var);
 			_stack->push(_operand);
@@ -701,15 +709,14 @@ bool ScScript::executeInstruction() {
 	}
 
 	case II_PUSH_VAR_REF: {
-		ScValue *var = getVar(_symbols[getDWORD()]);
+		ScValue *var = getVar(getDWORD());
 		_operand->setReference(var);
 		_stack->push(_operand);
 		break;
 	}
 
 	case II_POP_VAR: {
-		char *varName = _symbols[getDWORD()];
-		ScValue *var = getVar(varName);
+		ScValue *var = getVar(getDWORD());
 		if (var) {
 			ScValue *val = _stack->pop();
 			if (!val) {
@@ -762,7 +769,7 @@ bool ScScript::executeInstruction() {
 		break;
 
 	case II_PUSH_THIS:
-		_operand->setReference(getVar(_symbols[getDWORD()]));
+		_operand->setReference(getVar(getDWORD()));
 		_thisStack->push(_operand);
 		break;
 
@@ -1119,28 +1126,24 @@ uint32 ScScript::getMethodPos(const Common::String &name) {
 
 
 //////////////////////////////////////////////////////////////////////////
-ScValue *ScScript::getVar(char *name) {
+ScValue *ScScript::getVar(uint32 symbol) {
+	const AnsiString &key = _symbolKeys[symbol];
+	char *name = _symbols[symbol];
 	ScValue *ret = NULL;
 
 	// scope locals
 	if (_scopeStack->_sP >= 0) {
-		if (_scopeStack->getTop()->propExists(name)) {
-			ret = _scopeStack->getTop()->getProp(name);
-		}
+		ret = _scopeStack->getTop()->findProp(key);
 	}
 
 	// script globals
 	if (ret == NULL) {
-		if (_globals->propExists(name)) {
-			ret = _globals->getProp(name);
-		}
+		ret = _globals->findProp(key);
 	}
 
 	// engine globals
 	if (ret == NULL) {
-		if (_engine->_globals->propExists(name)) {
-			ret = _engine->_globals->getProp(name);
-		}
+		ret = _engine->_globals->findProp(key);
 	}
 
 	if (ret == NULL) {
@@ -76,7 +76,7 @@ public:
 	ScScript *_waitScript;
 	TScriptState _state;
 	TScriptState _origState;
-	ScValue *getVar(char *name);
+	ScValue *getVar(uint32 symbol);
 	uint32 getFuncPos(const Common::String &name);
 	uint32 getEventPos(const Common::String &name);
 	uint32 getMethodPos(const Common::String &name);
@@ -149,6 +149,7 @@ public:
 	bool externalCall(ScStack *stack, ScStack *thisStack, ScScript::TExternalFunction *function);
 private:
 	char **_symbols;
+	AnsiString *_symbolKeys;
 	uint32 _numSymbols;
 	TFunctionPos *_functions;
 	TMethodPos *_methods;
@@ -35,6 +35,8 @@
 #include "engines/wintermute/base/base_game.h"
 #include "engines/wintermute/base/base_file_manager.h"
 #include "engines/wintermute/utils/utils.h"
+#include "common/algorithm.h"
+#include "common/config-manager.h"
 
 namespace Wintermute {
 
@@ -68,10 +70,11 @@ ScEngine::ScEngine(BaseGame *inGame) : BaseClass(inGame) {
 		_globals->setProp("Math", &val);
 	}
 
-	// prepare script cache
-	for (int i = 0; i < MAX_CACHED_SCRIPTS; i++) {
-		_cachedScripts[i] = NULL;
-	}
+	// prepare script cache, the budget is in KB
+	int budget = ConfMan.hasKey("script_cache_size") ? ConfMan.getInt("script_cache_size") : 2048;
+	_cachedScriptsBudget = MAX(budget, 0) * 1024;
+	_cachedScriptsSize = 0;
+	_cacheHits = _cacheMisses = 0;
 
 	_currentScript = NULL;
 
@@ -174,14 +177,15 @@ ScScript *ScEngine::runScript(const char *filename, BaseScriptHolder *owner) {
 byte *ScEngine::getCompiledScript(const char *filename, uint32 *outSize, bool ignoreCache) {
 	// is script in cache?
 	if (!ignoreCache) {
-		for (int i = 0; i < MAX_CACHED_SCRIPTS; i++) {
-			if (_cachedScripts[i] && scumm_stricmp(_cachedScripts[i]->_filename.c_str(), filename) == 0) {
-				_cachedScripts[i]->_timestamp = g_system->getMillis();
-				*outSize = _cachedScripts[i]->_size;
-				return _cachedScripts[i]->_buffer;
-			}
+		ScriptCache::iterator it = _cachedScripts.find(filename);
+		if (it != _cachedScripts.end()) {
+			it->_value->_timestamp = g_system->getMillis();
+			*outSize = it->_value->_size;
+			_cacheHits++;
+			return it->_value->_buffer;
 		}
 	}
+	_cacheMisses++;
 
 	// nope, load it
 	byte *compBuffer;
@@ -212,25 +216,29 @@ byte *ScEngine::getCompiledScript(const char *filename, uint32 *outSize, bool ig
 
 	byte *ret = NULL;
 
-	// add script to cache
+	// add script to cache, replacing an older copy of it
 	CScCachedScript *cachedScript = new CScCachedScript(filename, compBuffer, compSize);
 	if (cachedScript) {
-		int index = 0;
-		uint32 minTime = g_system->getMillis();
-		for (int i = 0; i < MAX_CACHED_SCRIPTS; i++) {
-			if (_cachedScripts[i] == NULL) {
-				index = i;
-				break;
-			} else if (_cachedScripts[i]->_timestamp <= minTime) {
-				minTime = _cachedScripts[i]->_timestamp;
-				index = i;
-			}
+		ScriptCache::iterator it = _cachedScripts.find(filename);
+		if (it != _cachedScripts.end()) {
+			_cachedScriptsSize -= it->_value->_size;
+			delete it->_value;
 		}
-
-		if (_cachedScripts[index] != NULL) {
-			delete _cachedScripts[index];
+		_cachedScripts[filename] = cachedScript;
+		_cachedScriptsSize += compSize;
+
+		// Evict the least recently used scripts, but always keep the new one
+		while (_cachedScriptsSize > _cachedScriptsBudget && _cachedScripts.size() > 1) {
+			ScriptCache::iterator oldest = _cachedScripts.end();
+			for (it = _cachedScripts.begin(); it != _cachedScripts.end(); ++it) {
+				if (it->_value != cachedScript && (oldest == _cachedScripts.end() || it->_value->_timestamp < oldest->_value->_timestamp)) {
+					oldest = it;
+				}
+			}
+			_cachedScriptsSize -= oldest->_value->_size;
+			delete oldest->_value;
+			_cachedScripts.erase(oldest);
 		}
-		_cachedScripts[index] = cachedScript;
 
 		ret = cachedScript->_buffer;
 		*outSize = cachedScript->_size;
@@ -442,12 +450,12 @@ int ScEngine::getNumScripts(int *running, int *waiting, int *persistent) {
 
 //////////////////////////////////////////////////////////////////////////
 bool ScEngine::emptyScriptCache() {
-	for (int i = 0; i < MAX_CACHED_SCRIPTS; i++) {
-		if (_cachedScripts[i]) {
-			delete _cachedScripts[i];
-			_cachedScripts[i] = NULL;
-		}
+	ScriptCache::iterator it;
+	for (it = _cachedScripts.begin(); it != _cachedScripts.end(); ++it) {
+		delete it->_value;
 	}
+	_cachedScripts.clear();
+	_cachedScriptsSize = 0;
 	return STATUS_OK;
 }
 
@@ -556,6 +564,16 @@ void ScEngine::addScriptTime(const char *filename, uint32 time) {
 }
 
 
+//////////////////////////////////////////////////////////////////////////
+void ScEngine::addMethodCall(const char *name) {
+	if (!_isProfiling) {
+		return;
+	}
+
+	_methodCalls[name]++;
+}
+
+
 //////////////////////////////////////////////////////////////////////////
 void ScEngine::enableProfiling() {
 	if (_isProfiling) {
@@ -564,6 +582,7 @@ void ScEngine::enableProfiling() {
 
 	// destroy old data, if any
 	_scriptTimes.clear();
+	_methodCalls.clear();
 
 	_profilingStartTime = g_system->getMillis();
 	_isProfiling = true;
@@ -582,28 +601,47 @@ void ScEngine::disableProfiling() {
 
 
 //////////////////////////////////////////////////////////////////////////
-void ScEngine::dumpStats() {
-	error("DumpStats not ported to ScummVM yet");
-	/*  uint32 totalTime = g_system->getMillis() - _profilingStartTime;
+struct ScProfileEntry {
+	Common::String _name;
+	uint32 _value;
+
+	bool operator<(const ScProfileEntry &other) const {
+		return _value > other._value;
+	}
+};
+
+static void sortProfile(const Common::HashMap<Common::String, uint32> &values, Common::Array<ScProfileEntry> &entries) {
+	Common::HashMap<Common::String, uint32>::const_iterator it;
+	for (it = values.begin(); it != values.end(); ++it) {
+		ScProfileEntry entry;
+		entry._name = it->_key;
+		entry._value = it->_value;
+		entries.push_back(entry);
+	}
+	Common::sort(entries.begin(), entries.end());
+}
 
-	    typedef std::vector <std::pair<uint32, std::string> > TimeVector;
-	    TimeVector times;
+//////////////////////////////////////////////////////////////////////////
+void ScEngine::dumpStats() {
+	uint32 totalTime = g_system->getMillis() - _profilingStartTime;
 
-	    ScriptTimes::iterator it;
-	    for (it = _scriptTimes.begin(); it != _scriptTimes.end(); ++it) {
-	        times.push_back(std::pair<uint32, std::string> (it->_value, it->_key));
-	    }
-	    std::sort(times.begin(), times.end());
+	Common::Array<ScProfileEntry> times;
+	sortProfile(_scriptTimes, times);
 
+	_gameRef->LOG(0, "***** Script profiling information: *****");
+	_gameRef->LOG(0, "  %-40s %fs", "Total execution time", (float)totalTime / 1000);
 
-	    TimeVector::reverse_iterator tit;
+	for (uint i = 0; i < times.size(); i++) {
+		_gameRef->LOG(0, "  %-40s %fs (%f%%)", times[i]._name.c_str(), (float)times[i]._value / 1000, totalTime ? (float)times[i]._value / (float)totalTime * 100 : 0.0f);
+	}
 
-	    _gameRef->LOG(0, "***** Script profiling information: *****");
-	    _gameRef->LOG(0, "  %-40s %fs", "Total execution time", (float)totalTime / 1000);
+	Common::Array<ScProfileEntry> calls;
+	sortProfile(_methodCalls, calls);
 
-	    for (tit = times.rbegin(); tit != times.rend(); ++tit) {
-	        _gameRef->LOG(0, "  %-40s %fs (%f%%)", tit->second.c_str(), (float)tit->first / 1000, (float)tit->first / (float)totalTime * 100);
-	    }*/
+	_gameRef->LOG(0, "***** Method calls: *****");
+	for (uint i = 0; i < calls.size(); i++) {
+		_gameRef->LOG(0, "  %-40s %d", calls[i]._name.c_str(), calls[i]._value);
+	}
 }
 
 } // end of namespace Wintermute
@@ -32,10 +32,10 @@
 #include "engines/wintermute/persistent.h"
 #include "engines/wintermute/coll_templ.h"
 #include "engines/wintermute/base/base.h"
+#include "common/hash-str.h"
 
 namespace Wintermute {
 
-#define MAX_CACHED_SCRIPTS 20
 class ScScript;
 class ScValue;
 class BaseObject;
@@ -117,16 +117,27 @@ public:
 	}
 
 	void addScriptTime(const char *filename, uint32 Time);
+	void addMethodCall(const char *name);
 	void dumpStats();
 
+	uint32 getScriptCacheSize() const {
+		return _cachedScriptsSize;
+	}
+	uint32 _cacheHits;
+	uint32 _cacheMisses;
+
 private:
 
-	CScCachedScript *_cachedScripts[MAX_CACHED_SCRIPTS];
+	typedef Common::HashMap<Common::String, CScCachedScript *, Common::IgnoreCase_Hash, Common::IgnoreCase_EqualTo> ScriptCache;
+	ScriptCache _cachedScripts;
+	uint32 _cachedScriptsSize;
+	uint32 _cachedScriptsBudget;
 	bool _isProfiling;
 	uint32 _profilingStartTime;
 
 	typedef Common::HashMap<Common::String, uint32> ScriptTimes;
 	ScriptTimes _scriptTimes;
+	ScriptTimes _methodCalls;
 
 };
 
@@ -27,6 +27,14 @@
 #include "graphics/primitives.h"
 #include "engines/wintermute/graphics/transparent_surface.h"
 
+#if defined(SCUMM_LITTLE_ENDIAN) && defined(__SSE2__)
+#include <emmintrin.h>
+#define WINTERMUTE_BLIT_SSE2
+#elif defined(SCUMM_LITTLE_ENDIAN) && defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define WINTERMUTE_BLIT_NEON
+#endif
+
 namespace Wintermute {
 
 byte *TransparentSurface::_lookup = NULL;
@@ -50,21 +58,126 @@ TransparentSurface::TransparentSurface(const Surface &surf, bool copyData) : Sur
 	}
 }
 
-void doBlitOpaque(byte *ino, byte* outo, uint32 width, uint32 height, uint32 pitch, int32 inStep, int32 inoStep) {
-	byte *in, *out;
+#ifdef WINTERMUTE_BLIT_SSE2
+/**
+ * Blends the leading multiple of 4 pixels of a row, returns how many were done.
+ * Matches the lookup-table arithmetic of doBlitAlpha exactly.
+ */
+static uint32 blendAlphaRow(const byte *in, byte *out, uint32 width, int32 inStep) {
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i alphaMask = _mm_set1_epi32((int)0xFF000000);
+	const __m128i full = _mm_set1_epi16(255);
+	uint32 j = 0;
+	for (; j + 4 <= width; j += 4, out += 16) {
+		__m128i src;
+		if (inStep > 0) {
+			src = _mm_loadu_si128((const __m128i *)in);
+		} else {
+			// Mirrored, the next 4 pixels are the ones before in
+			src = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)(in - 12)), _MM_SHUFFLE(0, 1, 2, 3));
+		}
+		in += inStep * 4;
+
+		const __m128i srcAlpha = _mm_and_si128(src, alphaMask);
+		const __m128i transparent = _mm_cmpeq_epi32(srcAlpha, zero);
+		if (_mm_movemask_epi8(transparent) == 0xFFFF)
+			continue;
+		const __m128i opaque = _mm_cmpeq_epi32(srcAlpha, alphaMask);
+		const __m128i dst = _mm_loadu_si128((const __m128i *)out);
+
+		const __m128i srcLo = _mm_unpacklo_epi8(src, zero);
+		const __m128i srcHi = _mm_unpackhi_epi8(src, zero);
+		const __m128i aLo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(srcLo, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+		const __m128i aHi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(srcHi, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+		const __m128i blendLo = _mm_add_epi16(_mm_srli_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(dst, zero), _mm_sub_epi16(full, aLo)), 8),
+		                                      _mm_srli_epi16(_mm_mullo_epi16(srcLo, aLo), 8));
+		const __m128i blendHi = _mm_add_epi16(_mm_srli_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(dst, zero), _mm_sub_epi16(full, aHi)), 8),
+		                                      _mm_srli_epi16(_mm_mullo_epi16(srcHi, aHi), 8));
+
+		__m128i result = _mm_or_si128(_mm_packus_epi16(blendLo, blendHi), alphaMask);
+		result = _mm_or_si128(_mm_and_si128(opaque, src), _mm_andnot_si128(opaque, result));
+		result = _mm_or_si128(_mm_and_si128(transparent, dst), _mm_andnot_si128(transparent, result));
+		_mm_storeu_si128((__m128i *)out, result);
+	}
+	return j;
+}
 
-#ifdef SCUMM_LITTLE_ENDIAN
-	const int aIndex = 3;
+/** Copies the leading multiple of 4 pixels of a row with full alpha, returns how many were done. */
+static uint32 copyOpaqueRow(const byte *in, byte *out, uint32 width, int32 inStep) {
+	const __m128i alphaMask = _mm_set1_epi32((int)0xFF000000);
+	uint32 j = 0;
+	for (; j + 4 <= width; j += 4, in += inStep * 4, out += 16) {
+		__m128i src;
+		if (inStep > 0) {
+			src = _mm_loadu_si128((const __m128i *)in);
+		} else {
+			src = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)(in - 12)), _MM_SHUFFLE(0, 1, 2, 3));
+		}
+		_mm_storeu_si128((__m128i *)out, _mm_or_si128(src, alphaMask));
+	}
+	return j;
+}
+#elif defined(WINTERMUTE_BLIT_NEON)
+/**
+ * Blends the leading multiple of 8 pixels of an unmirrored row, returns how many were done.
+ * Matches the lookup-table arithmetic of doBlitAlpha exactly.
+ */
+static uint32 blendAlphaRow(const byte *in, byte *out, uint32 width, int32 inStep) {
+	if (inStep != 4)
+		return 0;
+	uint32 j = 0;
+	for (; j + 8 <= width; j += 8, in += 32, out += 32) {
+		const uint8x8x4_t src = vld4_u8(in);
+		uint8x8x4_t dst = vld4_u8(out);
+		const uint8x8_t a = src.val[3];
+		const uint8x8_t inv = vmvn_u8(a);
+		const uint8x8_t transparent = vceq_u8(a, vdup_n_u8(0));
+		const uint8x8_t opaque = vceq_u8(a, vdup_n_u8(255));
+		for (int c = 0; c < 3; c++) {
+			uint8x8_t blended = vadd_u8(vshrn_n_u16(vmull_u8(dst.val[c], inv), 8), vshrn_n_u16(vmull_u8(src.val[c], a), 8));
+			blended = vbsl_u8(opaque, src.val[c], blended);
+			dst.val[c] = vbsl_u8(transparent, dst.val[c], blended);
+		}
+		dst.val[3] = vbsl_u8(transparent, dst.val[3], vdup_n_u8(255));
+		vst4_u8(out, dst);
+	}
+	return j;
+}
+
+/** Copies the leading multiple of 4 pixels of an unmirrored row with full alpha, returns how many were done. */
+static uint32 copyOpaqueRow(const byte *in, byte *out, uint32 width, int32 inStep) {
+	if (inStep != 4)
+		return 0;
+	const uint32x4_t alphaMask = vdupq_n_u32(0xFF000000);
+	uint32 j = 0;
+	for (; j + 4 <= width; j += 4, in += 16, out += 16) {
+		vst1q_u32((uint32 *)out, vorrq_u32(vld1q_u32((const uint32 *)in), alphaMask));
+	}
+	return j;
+}
 #else
-	const int aIndex = 0;
+static uint32 blendAlphaRow(const byte *in, byte *out, uint32 width, int32 inStep) {
+	return 0;
+}
+
+static uint32 copyOpaqueRow(const byte *in, byte *out, uint32 width, int32 inStep) {
+	return 0;
+}
 #endif
 
+void doBlitOpaque(byte *ino, byte* outo, uint32 width, uint32 height, uint32 pitch, int32 inStep, int32 inoStep) {
+	byte *in, *out;
+
 	for (uint32 i = 0; i < height; i++) {
 		out = outo;
 		in = ino;
-		memcpy(out, in, width * 4);
-		for (uint32 j = 0; j < width; j++) {
-			out[aIndex] = 0xFF;
+		uint32 j = copyOpaqueRow(in, out, width, inStep);
+		in += j * inStep;
+		out += j * 4;
+		// The alpha channel is the top byte of the native pixel on either endianness
+		for (; j < width; j++) {
+			*(uint32 *)out = *(const uint32 *)in | 0xFF000000;
+			in += inStep;
 			out += 4;
 		}
 		outo += pitch;
@@ -112,7 +225,10 @@ void TransparentSurface::doBlitAlpha(byte *ino, byte* outo, uint32 width, uint32
 	for (uint32 i = 0; i < height; i++) {
 		out = outo;
 		in = ino;
-		for (uint32 j = 0; j < width; j++) {
+		uint32 j = blendAlphaRow(in, out, width, inStep);
+		in += j * inStep;
+		out += j * 4;
+		for (; j < width; j++) {
 			uint32 pix = *(uint32 *)in;
 			uint32 oPix = *(uint32 *) out;
 			int b = (pix >> bShift) & 0xff;
@@ -400,14 +516,23 @@ TransparentSurface *TransparentSurface::scale(const Common::Rect &srcRect, const
 	int dstH = dstRect.height();
 
 	target->create((uint16)dstW, (uint16)dstH, this->format);
+	if (dstW <= 0 || dstH <= 0)
+		return target;
+
+	// The source column is the same for every row, so only compute it once
+	int *srcX = new int[dstW];
+	for (int x = 0; x < dstW; x++) {
+		srcX[x] = x * srcW / dstW + srcRect.left;
+	}
 
 	for (int y = 0; y < dstH; y++) {
+		const uint32 *src = (const uint32 *)getBasePtr(0, y * srcH / dstH + srcRect.top);
+		uint32 *dst = (uint32 *)target->getBasePtr(dstRect.left, y + dstRect.top);
 		for (int x = 0; x < dstW; x++) {
-			uint32 color = READ_UINT32((const byte *)getBasePtr(x * srcW / dstW + srcRect.left,
-														  y * srcH / dstH + srcRect.top));
-			WRITE_UINT32((byte *)target->getBasePtr(x + dstRect.left, y + dstRect.top), color);
+			dst[x] = src[srcX[x]];
 		}
 	}
+	delete[] srcX;
 	return target;
 
 }